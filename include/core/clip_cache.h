@@ -0,0 +1,61 @@
+#pragma once
+
+#include <QHash>
+#include <QString>
+
+class QLockFile;
+
+/**
+ * @brief 같은 PC의 여러 클라이언트 인스턴스가 함께 쓰는 클립 캐시
+ *
+ * 클립마다 `<파일>.lock` 잠금 파일(QLockFile)로 프로세스 간 single-flight를 보장합니다.
+ * 잠금을 얻은 인스턴스만 다운로드하고, 나머지는 완료된 파일이 나타날 때까지 기다립니다.
+ * 받는 중인 데이터는 `<파일>.part`에 쓰고 완료 후 이름을 바꾸므로 최종 경로에는
+ * 완성된 파일만 존재합니다. 잠금을 가진 프로세스가 죽으면 잠금은 stale로 처리되어
+ * 기다리던 인스턴스가 이어받습니다. 모든 메서드는 I/O 스레드에서 호출해야 합니다.
+ */
+class ClipCache {
+public:
+    /// 클립 선점 결과
+    enum Claim {
+        Hit,        ///< 완료된 파일이 캐시에 있음
+        Acquired,   ///< 잠금 획득, 이 인스턴스가 받아야 함
+        Busy,       ///< 다른 인스턴스(또는 요청)가 받는 중
+        Failed      ///< 잠금 파일을 만들 수 없음
+    };
+
+    explicit ClipCache(const QString& directory = defaultDirectory());
+    ~ClipCache();
+
+    /// 캐시 디렉토리 생성 (새로 만들면 다른 사용자도 쓸 수 있게 권한 설정)
+    bool ensureDirectory() const;
+    /// 완료된 파일이 있으면 Hit, 없으면 다운로드 잠금 획득 시도
+    Claim claim(const QString& fileName);
+    /// 다운로드 종료: 성공이면 .part를 최종 경로로 옮기고 잠금 해제
+    bool finish(const QString& fileName, bool success);
+    /// 클립 부가 정보 저장 (`<파일>.meta`, 잠금을 가진 동안 finish 전에 호출)
+    bool writeMetadata(const QString& fileName, const QByteArray& data) const;
+    /// 클립 부가 정보 읽기 (없으면 빈 값)
+    QByteArray metadata(const QString& fileName) const;
+    /// 다른 인스턴스가 지금까지 받은 크기 (.part 파일)
+    qint64 inProgressBytes(const QString& fileName) const;
+    /// .part 파일의 마지막 수정 시각 (ms, 없으면 0)
+    qint64 lastActivityMs(const QString& fileName) const;
+    /// 메모리에 모아 쓰는 다운로드(구간 파일)의 진행 표시로 .part 수정 시각 갱신
+    void touch(const QString& fileName) const;
+    /// 잠기지 않은 파일만 삭제 (다른 인스턴스가 받는 중인 파일은 유지)
+    void clear();
+
+    QString directory() const { return m_directory; }
+    QString pathFor(const QString& fileName) const { return m_directory + "/" + fileName; }
+    QString partPathFor(const QString& fileName) const { return pathFor(fileName) + ".part"; }
+
+    /// 기본 캐시 디렉토리 (설정 cache/sharedDir, 없으면 임시 디렉토리)
+    static QString defaultDirectory();
+
+private:
+    Q_DISABLE_COPY(ClipCache)
+
+    QString m_directory;                        ///< 캐시 디렉토리
+    QHash<QString, QLockFile*> m_locks;         ///< 이 인스턴스가 받는 중인 클립의 잠금
+};
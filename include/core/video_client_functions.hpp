@@ -8,6 +8,7 @@
 #include <QJsonArray>
 #include <QTimer>
 #include <QFile>
+#include <QFileInfo>
 #include <QDir>
 #include <QStandardPaths>
 #include <QMediaPlayer>
@@ -16,30 +17,87 @@
 #include <QLabel>
 #include <QListWidget>
 #include <QListWidgetItem>
+#include <QThread>
+#include <QPointer>
+#include <QElapsedTimer>
 #include <functional>
+#include <memory>
+#include <type_traits>
 #include "../network/mqtt.h"
+#include "../network/bandwidth_governor.h"
+#include "../network/io_worker.h"
 
-using VideoDownloadCallback = std::function<void(bool success, const QString& local_path)>;
-
+/**
+ * 네트워크/파일 작업은 전용 I/O 스레드의 IoWorker에서 실행되고,
+ * 콜백과 진행률/상태 표시는 GUI 스레드로 전달됩니다.
+ * 모든 공개 메서드는 GUI 스레드에서 호출합니다.
+ */
 class VideoClient : public QObject {
     Q_OBJECT
 
 private:
-    QNetworkAccessManager* m_networkManager;
     QString m_tempDir;
-    MqttClient* m_mqttClient;
+    QThread* m_ioThread;
+    IoWorker* m_worker;
+    
+    static constexpr int PROGRESS_INTERVAL_MS = 50;
+    
+    // I/O 스레드에서 호출된 콜백을 GUI 스레드에서 실행
+    template <typename... Args>
+    std::function<void(Args...)> onGuiThread(std::common_type_t<std::function<void(Args...)>> fn) {
+        if (!fn) return nullptr;
+        return [this, fn](Args... args) {
+            QMetaObject::invokeMethod(this, [fn, args...]() { fn(args...); }, Qt::QueuedConnection);
+        };
+    }
+    
+    // 진행률 표시 (GUI 갱신은 PROGRESS_INTERVAL_MS 간격으로 제한)
+    IoWorker::ProgressHandler progressHandler(QProgressBar* progressBar) {
+        if (!progressBar) return nullptr;
+        QPointer<QProgressBar> bar(progressBar);
+        auto lastUpdate = std::make_shared<QElapsedTimer>();
+        return [this, bar, lastUpdate](qint64 received, qint64 total) {
+            if (lastUpdate->isValid() && lastUpdate->elapsed() < PROGRESS_INTERVAL_MS
+                && (total <= 0 || received < total)) return;
+            lastUpdate->start();
+            QMetaObject::invokeMethod(this, [bar, received, total]() {
+                if (bar) {
+                    // 전체 크기를 모르면 (다른 인스턴스의 다운로드 대기 등) 진행 중 표시
+                    bar->setMaximum(total > 0 ? total : 0);
+                    bar->setValue(total > 0 ? received : 0);
+                }
+            }, Qt::QueuedConnection);
+        };
+    }
+    
+    // 상태 메시지 표시
+    IoWorker::StatusHandler statusHandler(QLabel* statusLabel) {
+        if (!statusLabel) return nullptr;
+        QPointer<QLabel> label(statusLabel);
+        return onGuiThread<const QString&>([label](const QString& status) {
+            if (label) label->setText(status);
+        });
+    }
     
 public:
     VideoClient(QObject* parent = nullptr) : QObject(parent) {
-        m_networkManager = new QNetworkAccessManager(this);
-        m_mqttClient = new MqttClient(this);
+        // 캐시 디렉토리 설정 (같은 PC의 다른 인스턴스와 공유)
+        m_tempDir = ClipCache::defaultDirectory();
         
-        // 임시 디렉토리 설정
-        m_tempDir = QStandardPaths::writableLocation(QStandardPaths::TempLocation) + "/factory_videos";
-        QDir().mkpath(m_tempDir);
-        
-        // MQTT 연결
-        m_mqttClient->connectToHost();
+        // I/O 스레드 시작 (네트워크 객체와 MQTT 연결은 스레드 안에서 생성)
+        m_ioThread = new QThread(this);
+        m_ioThread->setObjectName("VideoClientIO");
+        m_worker = new IoWorker(m_tempDir);
+        m_worker->moveToThread(m_ioThread);
+        connect(m_ioThread, &QThread::started, m_worker, &IoWorker::initialize);
+        connect(m_ioThread, &QThread::finished, m_worker, &QObject::deleteLater);
+        m_ioThread->start();
+    }
+    
+    ~VideoClient() {
+        // 진행 중인 작업의 콜백이 this를 참조하므로 스레드 종료까지 대기
+        m_ioThread->quit();
+        m_ioThread->wait();
     }
     
     // 1. 비디오 목록 조회 (MQTT 통신)
@@ -50,66 +108,68 @@ public:
                     int limit = 50,
                     VideoQueryCallback callback = nullptr) {
         
-        m_mqttClient->queryVideos(device_id, error_log_id, start_time, end_time, limit, callback);
+        // 응답 파싱은 I/O 스레드에서, 결과 전달은 GUI 스레드에서
+        IoWorker* worker = m_worker;
+        VideoQueryCallback done = onGuiThread<const QList<VideoInfo>&>(callback);
+        QMetaObject::invokeMethod(worker, [=]() {
+            worker->queryVideos(device_id, error_log_id, start_time, end_time, limit, done);
+        }, Qt::QueuedConnection);
+    }
+    
+    // 1-1. 여러 브로커 동시 조회 (응답이 올 때마다 병합 결과 전달)
+    void queryVideosStreaming(const QString& device_id,
+                              const QString& error_log_id,
+                              qint64 start_time,
+                              qint64 end_time,
+                              int limit,
+                              VideoQueryStreamCallback callback) {
+        
+        IoWorker* worker = m_worker;
+        VideoQueryStreamCallback update =
+            onGuiThread<const QList<VideoInfo>&, const VideoQueryProgress&>(callback);
+        QMetaObject::invokeMethod(worker, [=]() {
+            worker->queryVideosStreaming(device_id, error_log_id, start_time, end_time, limit, update);
+        }, Qt::QueuedConnection);
     }
     
     // 2. 비디오 파일 다운로드
     void downloadVideo(const QString& http_url, 
                       VideoDownloadCallback callback = nullptr,
                       QProgressBar* progressBar = nullptr,
-                      QLabel* statusLabel = nullptr) {
+                      QLabel* statusLabel = nullptr,
+                      BandwidthGovernor::TrafficClass trafficClass = BandwidthGovernor::Interactive) {
         
-        QNetworkRequest request(http_url);
-        request.setRawHeader("User-Agent", "Factory Video Client");
-        
-        QNetworkReply* reply = m_networkManager->get(request);
-        
-        // 파일명 추출
-        QString fileName = http_url.split('/').last();
-        QString localPath = m_tempDir + "/" + fileName;
-        
-        QFile* file = new QFile(localPath);
-        if (!file->open(QIODevice::WriteOnly)) {
-            if (callback) callback(false, "");
-            delete file;
-            return;
-        }
+        IoWorker* worker = m_worker;
+        VideoDownloadCallback done = onGuiThread<bool, const QString&>(callback);
+        IoWorker::ProgressHandler progress = progressHandler(progressBar);
+        IoWorker::StatusHandler status = statusHandler(statusLabel);
+        QMetaObject::invokeMethod(worker, [=]() {
+            worker->download(http_url, trafficClass, done, progress, status);
+        }, Qt::QueuedConnection);
+    }
+    
+    // 2-1. 비디오 시간 구간만 다운로드 (MP4 moov + HTTP Range)
+    void fetchRange(const QString& http_url,
+                    qint64 start_ms,
+                    qint64 end_ms,
+                    VideoRangeCallback callback = nullptr,
+                    QProgressBar* progressBar = nullptr,
+                    QLabel* statusLabel = nullptr) {
         
-        // 상태 표시
         if (statusLabel) {
-            statusLabel->setText(QString("Downloading: %1").arg(fileName));
+            statusLabel->setText(QString("Fetching %1 (%2 - %3)")
+                                 .arg(http_url.split('/').last())
+                                 .arg(formatDuration(start_ms / 1000))
+                                 .arg(formatDuration(end_ms / 1000)));
         }
         
-        // 진행률 업데이트
-        connect(reply, &QNetworkReply::downloadProgress, [progressBar](qint64 received, qint64 total) {
-            if (progressBar && total > 0) {
-                progressBar->setMaximum(total);
-                progressBar->setValue(received);
-            }
-        });
-        
-        // 데이터 수신
-        connect(reply, &QNetworkReply::readyRead, [reply, file]() {
-            file->write(reply->readAll());
-        });
-        
-        // 완료 처리
-        connect(reply, &QNetworkReply::finished, [reply, file, localPath, callback, statusLabel]() {
-            file->close();
-            delete file;
-            
-            bool success = (reply->error() == QNetworkReply::NoError);
-            
-            if (statusLabel) {
-                statusLabel->setText(success ? "Download completed" : "Download failed");
-            }
-            
-            if (callback) {
-                callback(success, success ? localPath : "");
-            }
-            
-            reply->deleteLater();
-        });
+        IoWorker* worker = m_worker;
+        VideoRangeCallback done = onGuiThread<bool, const QString&, qint64>(callback);
+        IoWorker::ProgressHandler progress = progressHandler(progressBar);
+        IoWorker::StatusHandler status = statusHandler(statusLabel);
+        QMetaObject::invokeMethod(worker, [=]() {
+            worker->fetchRange(http_url, start_ms, end_ms, done, progress, status);
+        }, Qt::QueuedConnection);
     }
     
     // 3. 비디오 재생
@@ -129,9 +189,8 @@ public:
     
     // 4. 캐시 관리
     void clearCache() {
-        QDir cacheDir(m_tempDir);
-        cacheDir.removeRecursively();
-        QDir().mkpath(m_tempDir);
+        IoWorker* worker = m_worker;
+        QMetaObject::invokeMethod(worker, [worker]() { worker->clearCache(); }, Qt::QueuedConnection);
     }
     
     QString getCacheDir() const {
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <QString>
+#include <QList>
+#include "../network/mqtt.h"
+
+/**
+ * @brief 최근 조회 결과의 디스크 스냅샷
+ * 
+ * 마지막으로 받은 비디오 목록을 컴팩트한 바이너리 파일로 저장하고,
+ * 시작 시 동기적으로 읽어 MQTT 연결 전에도 목록을 바로 보여줄 수 있게 합니다.
+ * 파일은 메모리 매핑으로 읽으며 JSON 파싱을 거치지 않습니다.
+ */
+class VideoListCache {
+public:
+    explicit VideoListCache(const QString& filePath = defaultPath());
+
+    /// 스냅샷 읽기 (파일이 없거나 형식이 맞지 않으면 false)
+    bool load(QList<VideoInfo>& videos, qint64* savedAtMs = nullptr) const;
+    /// 스냅샷 저장 (임시 파일에 쓴 뒤 원자적으로 교체)
+    bool save(const QList<VideoInfo>& videos) const;
+
+    QString filePath() const { return m_filePath; }
+
+    /// 기본 스냅샷 경로 (앱 캐시 디렉토리)
+    static QString defaultPath();
+
+private:
+    QString m_filePath;                 ///< 스냅샷 파일 경로
+
+    // === 파일 형식 ===
+    static constexpr quint32 FILE_MAGIC = 0x46564C43; // "FVLC"
+    static constexpr quint16 FILE_VERSION = 1;
+    static constexpr qint64 MIN_RECORD_BYTES = 6 * 4 + 4 + 8 + 8; // 빈 문자열 6개 + 정수 필드
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <QObject>
+#include <QNetworkReply>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QTime>
+#include <QList>
+#include <functional>
+
+/**
+ * @brief 프로세스 전체 다운로드 대역폭 제한기 (토큰 버킷)
+ * 
+ * 모든 QNetworkReply의 읽기 버퍼를 작게 제한하고, 주기적으로 채워지는
+ * 토큰만큼만 reply에서 읽어 전달합니다. 버퍼가 차면 Qt가 소켓 읽기를
+ * 멈추므로 TCP 흐름 제어로 실제 수신 속도가 제한됩니다.
+ * 
+ * 대화형(사용자가 기다리는 다운로드)과 백그라운드(미리 받기) 트래픽은
+ * 별도 예산을 가지며, 설정의 시간대별 일정에 따라 한도가 바뀝니다.
+ * 
+ * 설정 키 (KB/s, 0이면 제한 없음):
+ * - bandwidth/interactiveKBps, bandwidth/backgroundKBps: 기본 한도
+ * - bandwidth/schedule: "08:00-18:00=2048/256" 형식 목록 (시간대=대화형/백그라운드)
+ */
+class BandwidthGovernor : public QObject {
+    Q_OBJECT
+
+public:
+    /// 트래픽 종류
+    enum TrafficClass {
+        Interactive = 0,                ///< 사용자가 기다리는 다운로드
+        Background = 1                  ///< 미리 받기 등 백그라운드 다운로드
+    };
+
+    using DataSink = std::function<void(const QByteArray& data)>;
+    using DoneHandler = std::function<void()>;
+
+    /// I/O 스레드에서 생성 (IoWorker가 소유)
+    explicit BandwidthGovernor(QObject *parent = nullptr);
+
+    /// reply를 관리 대상으로 등록 (데이터는 sink로, 모두 전달된 뒤 done 호출)
+    void attach(QNetworkReply* reply, TrafficClass trafficClass, DataSink sink, DoneHandler done);
+
+    /// 설정 다시 읽기 (한도/일정)
+    void reloadSettings();
+    /// 현재 시간대의 한도 (bytes/s, 0이면 제한 없음)
+    qint64 currentLimit(TrafficClass trafficClass) const;
+
+private:
+    /// 관리 중인 다운로드 하나
+    struct Stream {
+        QPointer<QNetworkReply> reply;
+        TrafficClass trafficClass;
+        DataSink sink;
+        DoneHandler done;
+        bool networkFinished = false;
+    };
+
+    /// 시간대별 한도
+    struct ScheduleEntry {
+        QTime start;
+        QTime end;
+        qint64 limits[2];
+    };
+
+    /// 토큰 버킷 하나
+    struct Bucket {
+        double tokens = 0;
+        qint64 rate = 0;                ///< bytes/s (0이면 제한 없음)
+    };
+
+    /// 토큰 보충 후 각 스트림에서 읽기
+    void onTick();
+    /// 한 트래픽 종류의 스트림들에 토큰을 나눠 읽기
+    void drainClass(TrafficClass trafficClass);
+    /// 모두 전달된 완료 스트림 정리
+    void completeFinishedStreams();
+    /// 현재 시각의 한도로 버킷 갱신
+    void updateRates();
+
+    QList<Stream> m_streams;            ///< 관리 중인 다운로드
+    Bucket m_buckets[2];                ///< 트래픽 종류별 버킷
+    qint64 m_defaultLimits[2] = {0, 0}; ///< 일정 밖 기본 한도 (bytes/s)
+    QList<ScheduleEntry> m_schedule;    ///< 시간대별 한도
+    QTimer* m_tickTimer;                ///< 토큰 보충 타이머
+    QElapsedTimer m_clock;              ///< 마지막 보충 이후 경과 시간
+
+    // === 상수 ===
+    static constexpr int TICK_INTERVAL_MS = 50;
+    static constexpr qint64 READ_BUFFER_SIZE = 64 * 1024;
+    static constexpr double BURST_SECONDS = 0.25;
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <QObject>
+#include <QNetworkAccessManager>
+#include <QString>
+#include <QHash>
+#include <QElapsedTimer>
+#include <functional>
+#include "mqtt.h"
+#include "bandwidth_governor.h"
+#include "../core/clip_cache.h"
+
+using VideoDownloadCallback = std::function<void(bool success, const QString& local_path)>;
+/// 구간 다운로드 결과 (start_offset_ms: 받은 파일에서 요청 구간이 시작하는 위치)
+using VideoRangeCallback = std::function<void(bool success, const QString& local_path, qint64 start_offset_ms)>;
+
+/**
+ * @brief VideoClient의 네트워크/파일 작업을 실행하는 I/O 스레드 객체
+ * 
+ * QNetworkAccessManager, MqttClient, 대역폭 제한기, 응답 파싱과 파일 쓰기가
+ * 모두 이 객체의 스레드에서 실행됩니다. 모든 메서드는 I/O 스레드에서
+ * 호출되어야 하며(VideoClient가 QMetaObject::invokeMethod로 전달),
+ * 콜백도 I/O 스레드에서 호출됩니다. GUI 스레드로 넘기는 것은 VideoClient가 담당합니다.
+ */
+class IoWorker : public QObject {
+    Q_OBJECT
+
+public:
+    using ProgressHandler = std::function<void(qint64 received, qint64 total)>;
+    using StatusHandler = std::function<void(const QString& status)>;
+
+    explicit IoWorker(const QString& cacheDir, QObject *parent = nullptr);
+
+    /// 스레드 시작 후 네트워크 객체 생성 및 MQTT 연결
+    void initialize();
+
+    /// 비디오 목록 조회 (MQTT)
+    void queryVideos(const QString& device_id, const QString& error_log_id,
+                     qint64 start_time, qint64 end_time, int limit,
+                     VideoQueryCallback callback);
+    /// 비디오 목록 조회 (모든 브로커, 응답마다 병합 결과 전달)
+    void queryVideosStreaming(const QString& device_id, const QString& error_log_id,
+                              qint64 start_time, qint64 end_time, int limit,
+                              VideoQueryStreamCallback callback);
+    /// 비디오 파일 다운로드 (캐시에 있으면 바로 완료, 다른 인스턴스가 받는 중이면 대기)
+    void download(const QString& http_url, BandwidthGovernor::TrafficClass trafficClass,
+                  VideoDownloadCallback callback, ProgressHandler progress, StatusHandler status);
+    /// 시간 구간만 다운로드 (실패시 전체 다운로드로 대체, 이때 시작 위치는 start_ms)
+    void fetchRange(const QString& http_url, qint64 start_ms, qint64 end_ms,
+                    VideoRangeCallback callback, ProgressHandler progress, StatusHandler status);
+    /// 캐시 디렉토리 비우기
+    void clearCache();
+
+private:
+    ClipCache m_clipCache;                              ///< 인스턴스 간 공유 클립 캐시
+    QNetworkAccessManager* m_networkManager = nullptr;  ///< I/O 스레드의 네트워크 매니저
+    BandwidthGovernor* m_bandwidthGovernor = nullptr;   ///< I/O 스레드의 대역폭 제한기
+    MqttClient* m_mqttClient = nullptr;                 ///< I/O 스레드의 MQTT 클라이언트
+
+    /// 다른 인스턴스의 다운로드를 기다리는 상태
+    struct CacheWait {
+        qint64 bytes = -1;                              ///< 마지막으로 본 .part 크기
+        qint64 activityMs = -1;                         ///< 마지막으로 본 .part 수정 시각
+        QElapsedTimer idle;                             ///< 변화가 없던 시간
+    };
+    QHash<QString, CacheWait> m_cacheWaits;             ///< 파일명 → 대기 상태
+
+    /// 다른 인스턴스의 다운로드 진행 확인 (진행률 전달, 멈췄으면 false)
+    bool otherDownloadAlive(const QString& fileName, ProgressHandler progress, StatusHandler status);
+
+    // === 상수 ===
+    static constexpr int CACHE_POLL_INTERVAL_MS = 500;  ///< 다른 인스턴스의 다운로드 확인 간격
+    static constexpr int CACHE_STALL_TIMEOUT_MS = 30000;    ///< .part가 이 시간 동안 그대로면 대기 실패
+};
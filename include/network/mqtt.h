@@ -4,6 +4,12 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QTimer>
+#include <QHash>
+#include <QPair>
+#include <QVector>
+#include <QDeadlineTimer>
+#include <QElapsedTimer>
+#include <QCborStreamReader>
 #include <QtMqtt/QMqttClient>
 #include <QtMqtt/QMqttMessage>
 #include <functional>
@@ -22,6 +28,33 @@ struct VideoInfo {
 
 using VideoQueryCallback = std::function<void(const QList<VideoInfo>&)>;
 
+/// 여러 브로커에 보낸 쿼리의 진행 상황
+struct VideoQueryProgress {
+    int total = 0;                      ///< 쿼리를 보낸 브로커 수
+    int answered = 0;                   ///< 성공 응답한 브로커 수
+    int failed = 0;                     ///< 실패 응답한 브로커 수
+    int timedOut = 0;                   ///< 기한 내 응답하지 않은 브로커 수
+    bool complete = false;              ///< 더 이상 결과가 바뀌지 않음
+};
+
+/// 응답이 도착할 때마다 지금까지의 병합 결과로 호출 (마지막 호출은 complete)
+using VideoQueryStreamCallback = std::function<void(const QList<VideoInfo>&, const VideoQueryProgress&)>;
+
+/// MQTT 브로커 주소
+struct MqttBrokerEndpoint {
+    QString host;
+    quint16 port = 1883;
+    int timeoutMs = 0;                  ///< 응답 기한 (0이면 기본값)
+};
+
+/// 쿼리 응답 내용 (JSON/CBOR 공통)
+struct VideoQueryResponse {
+    QString query_id;
+    QString status;
+    QString error;
+    QList<VideoInfo> data;
+};
+
 class MqttClient : public QObject {
     Q_OBJECT
 
@@ -36,13 +69,89 @@ public:
                     qint64 end_time = 0,
                     int limit = 50,
                     VideoQueryCallback callback = nullptr);
+    /// 모든 브로커에 동시에 조회하고 응답이 올 때마다 병합 결과 전달
+    void queryVideosStreaming(const QString& device_id,
+                              const QString& error_log_id,
+                              qint64 start_time,
+                              qint64 end_time,
+                              int limit,
+                              VideoQueryStreamCallback callback);
+
+    /// 설정(mqtt/brokers)의 브로커 목록 ("host:port[/timeoutMs],...")
+    static QList<MqttBrokerEndpoint> configuredBrokers();
+    /// 여러 목록을 video_created_time 내림차순으로 k-way 병합 (각 목록은 정렬되어 있어야 함)
+    static QList<VideoInfo> mergeByCreatedTime(const QVector<QList<VideoInfo>>& lists, int limit);
 
 private slots:
-    void onConnected();
-    void onMessageReceived(const QByteArray &message, const QMqttTopicName &topic);
+    void onConnected(int brokerIndex);
+    void onMessageReceived(int brokerIndex, const QByteArray &message, const QMqttTopicName &topic);
 
 private:
-    QMqttClient* m_client;
-    QMap<QString, VideoQueryCallback> m_pendingQueries;
-    QTimer* m_timeoutTimer;
+    /// 브로커 하나의 연결
+    struct Broker {
+        MqttBrokerEndpoint endpoint;
+        QMqttClient* client = nullptr;
+        QTimer* reconnectTimer = nullptr;       ///< 연결이 끊기면 주기적으로 재연결
+        QList<QPair<QString, QByteArray>> pendingPublishes;    ///< 연결 후 보낼 쿼리 (query_id, payload)
+    };
+    
+    /// 브로커별 응답 상태
+    enum BrokerState { Pending, Answered, Failed, TimedOut };
+    
+    /// 진행 중인 팬아웃 쿼리
+    struct FanOutQuery {
+        VideoQueryStreamCallback callback;
+        int limit = 0;
+        QVector<BrokerState> states;            ///< 브로커별 상태
+        QVector<QList<VideoInfo>> results;      ///< 브로커별 결과 (생성 시각 내림차순)
+        QVector<QDeadlineTimer> deadlines;      ///< 브로커별 응답 기한
+        QTimer* deadlineTimer = nullptr;        ///< 가장 이른 기한에 맞춘 타이머
+        QElapsedTimer elapsed;                  ///< 쿼리 경과 시간
+    };
+    
+    /// 브로커에 쿼리 전송 (연결 전이면 연결 후 전송)
+    void publish(int brokerIndex, const QString& query_id, const QByteArray& payload);
+    /// 보내지 못한 쿼리 버리기 (brokerIndex < 0이면 모든 브로커)
+    void dropPendingPublishes(const QString& query_id, int brokerIndex = -1);
+    /// 기한이 지난 브로커 처리 후 다음 기한으로 타이머 재설정
+    void checkDeadlines(const QString& query_id);
+    /// 현재까지의 병합 결과 전달 (모든 브로커가 끝났으면 쿼리 종료)
+    void deliver(const QString& query_id);
+    static VideoQueryProgress progressOf(const FanOutQuery& query);
+
+    /// 응답 형식 판별 후 압축 해제 및 파싱 (format: "json", "cbor", "cbor+deflate" 등)
+    static bool parseResponse(const QByteArray& message, VideoQueryResponse& response, QString& format);
+    static bool parseJsonResponse(const QByteArray& message, VideoQueryResponse& response);
+    /// DOM 없이 스트림으로 읽어 VideoInfo에 바로 채움
+    static bool parseCborResponse(const QByteArray& message, VideoQueryResponse& response);
+    static bool readCborVideo(QCborStreamReader& reader, VideoInfo& video);
+    static QString readCborString(QCborStreamReader& reader);
+    static qint64 readCborInteger(QCborStreamReader& reader);
+    /// zlib(deflate) 스트림 해제
+    static QByteArray inflate(const QByteArray& data);
+    /// 형식별 파싱 시간 누적 및 로그
+    void recordParseTime(const QString& format, qint64 bytes, int count, qint64 nsecs);
+
+    QList<Broker> m_brokers;                    ///< 연결된 브로커들
+    QHash<QString, FanOutQuery> m_queries;      ///< 진행 중인 쿼리
+    int m_defaultTimeoutMs;                     ///< 브로커별 기본 응답 기한
+    int m_querySequence = 0;                    ///< 같은 ms 내 쿼리 ID 구분
+    QString m_responseFormat;           ///< 요청할 응답 형식 ("cbor" 또는 "json")
+    QString m_compression;              ///< 요청할 압축 ("deflate" 또는 "none")
+    
+    /// 형식별 파싱 통계
+    struct ParseStats {
+        int messages = 0;
+        qint64 bytes = 0;
+        qint64 nsecs = 0;
+    };
+    QHash<QString, ParseStats> m_parseStats;
+    
+    // === 상수 ===
+    static constexpr quint64 MAX_RESERVED_ROWS = 1024;      ///< CBOR 배열 길이로 미리 할당할 최대 행 수
+    static constexpr qsizetype MAX_INFLATED_BYTES = 16 * 1024 * 1024;  ///< 압축 해제 결과 상한
+    static constexpr qsizetype INFLATE_CHUNK_BYTES = 256 * 1024;
+    static constexpr int DEFAULT_BROKER_TIMEOUT_MS = 5000;
+    static constexpr int RECONNECT_INTERVAL_MS = 5000;
+    static constexpr int MAX_PENDING_PUBLISHES = 16;        ///< 브로커별 연결 대기 쿼리 수
 };
\ No newline at end of file
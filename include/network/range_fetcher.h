@@ -0,0 +1,88 @@
+#pragma once
+
+#include <QObject>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QMap>
+#include <QList>
+#include <functional>
+#include "../video/mp4_index.h"
+#include "bandwidth_governor.h"
+
+/**
+ * @brief HTTP Range 요청으로 MP4의 시간 구간만 받아오는 작업
+ * 
+ * 1. 파일 앞부분을 받아 최상위 박스를 훑고 moov 위치를 찾음 (moov가 뒤에 있으면 건너뛰며 탐색)
+ * 2. moov만 받아 샘플 테이블을 파싱하고 요청 구간을 바이트 구간으로 변환
+ * 3. 필요한 구간(이전 키프레임 포함)만 받아 로컬에서 재인코딩 없이 MP4로 다시 작성
+ * 
+ * 서버가 Range를 지원하지 않거나 fragmented MP4이면 실패를 알리며,
+ * 호출자(VideoClient)는 전체 다운로드로 대체합니다.
+ */
+class RangeFetcher : public QObject {
+    Q_OBJECT
+
+public:
+    RangeFetcher(QNetworkAccessManager* manager,
+                 BandwidthGovernor* governor,
+                 const QString& url,
+                 qint64 startMs,
+                 qint64 endMs,
+                 const QString& outputPath,
+                 QObject *parent = nullptr);
+
+    /// 작업 시작 (완료시 finished 시그널)
+    void start();
+
+    /// 지금까지 받은 바이트 수
+    qint64 bytesReceived() const { return m_bytesReceived; }
+    /// 받은 클립의 실제 시작 시간 (요청 시작 이전 키프레임, ms)
+    qint64 selectedStartMs() const { return m_index.selectedStartMs(); }
+
+signals:
+    /// 구간 데이터 수신 진행률
+    void progress(qint64 received, qint64 total);
+    /// 작업 완료 (성공시 localPath에 재작성된 MP4)
+    void finished(bool success, const QString& localPath, const QString& error);
+
+private:
+    using RangeHandler = std::function<void(const QByteArray& data)>;
+
+    /// Range 요청 전송 (206 응답이 아니면 실패 처리)
+    void requestRange(qint64 offset, qint64 length, RangeHandler handler);
+    /// offset부터 최상위 박스 탐색
+    void probe(qint64 offset);
+    /// moov 수신 후 필요한 구간 계산
+    void onMoovReceived(const QByteArray& moov);
+    /// 남은 구간 요청 (동시 요청 수 제한)
+    void fetchPendingRanges();
+    /// 모든 구간 수신 후 로컬 MP4 작성
+    void writeOutput();
+    /// 작업 종료 (한 번만)
+    void finish(bool success, const QString& error);
+
+    QNetworkAccessManager* m_manager;   ///< 공유 네트워크 매니저
+    BandwidthGovernor* m_governor;      ///< I/O 스레드의 대역폭 제한기
+    QString m_url;                      ///< 원본 비디오 URL
+    qint64 m_startMs;                   ///< 요청 구간 시작 (ms)
+    qint64 m_endMs;                     ///< 요청 구간 끝 (ms)
+    QString m_outputPath;               ///< 결과 파일 경로
+
+    Mp4Index m_index;                   ///< moov 인덱스
+    QByteArray m_ftyp;                  ///< 원본 ftyp 박스
+    qint64 m_fileSize = -1;             ///< Content-Range로 알게 된 전체 크기
+    int m_probeCount = 0;               ///< moov 탐색 요청 횟수
+
+    QList<Mp4ByteRange> m_pendingRanges;        ///< 아직 요청하지 않은 구간
+    QMap<qint64, QByteArray> m_rangeData;       ///< 받은 구간 (시작 위치 → 데이터)
+    QList<QNetworkReply*> m_activeReplies;      ///< 진행 중인 요청
+    qint64 m_bytesReceived = 0;         ///< 받은 총 바이트
+    qint64 m_rangeBytesTotal = 0;       ///< 받아야 할 구간 바이트 합계
+    bool m_finished = false;            ///< 종료 여부
+
+    // === 상수 ===
+    static constexpr qint64 PROBE_SIZE = 64 * 1024;
+    static constexpr int MAX_PROBES = 16;
+    static constexpr qint64 RANGE_MERGE_GAP = 32 * 1024;
+    static constexpr int MAX_PARALLEL_RANGES = 4;
+};
@@ -10,8 +10,12 @@
 #include <QLineEdit>
 #include <QDateTimeEdit>
 #include <QComboBox>
+#include <QElapsedTimer>
 #include "../core/video_client_functions.hpp"
+#include "../core/video_list_cache.h"
 #include "../video/videoplayer.h"
+#include "../video/videoplayer_pool.h"
+#include "../video/player_governor.h"
 
 /**
  * @brief 메인 애플리케이션 창 - 비디오 목록 조회 및 관리
@@ -33,8 +37,14 @@ private slots:
     void onVideoSelected();
     /// 비디오 목록에서 항목 더블클릭 처리 (새 창에서 재생)
     void onVideoDoubleClicked();
-    /// VideoPlayer 창이 닫힐 때 리스트에서 제거
-    void onVideoPlayerClosed();
+    /// 비디오 목록 우클릭 메뉴 (구간 다운로드 등)
+    void onVideoContextMenu(const QPoint& pos);
+    /// 선택한 비디오의 시간 구간만 받아 재생
+    void onFetchRangeRequested();
+    /// VideoPlayer 창이 닫혀 풀로 반환되었을 때 상태 갱신
+    void onVideoPlayerClosed(VideoPlayer* player);
+    /// 플레이어 자원 사용 현황 표시
+    void onResourceStatsUpdated(const PlayerResourceStats& stats);
 
 private:
     /// UI 컴포넌트 초기화
@@ -49,8 +59,22 @@ private:
     void setupConnections();
     /// 검색 필터 초기값 설정
     void initializeFilters();
-    /// 비디오 목록에 데이터 채우기
-    void populateVideoList(const QList<VideoInfo>& videos);
+    /// 비디오 목록에 데이터 채우기 (stale이면 캐시된 목록으로 표시)
+    void populateVideoList(const QList<VideoInfo>& videos, bool stale = false);
+    /// 디스크 스냅샷에서 이전 목록을 동기적으로 불러오기
+    void loadCachedVideoList();
+    /// 같은 에러 로그 ID의 클립들로 재생 목록 구성 (생성 시간순)
+    QList<PlaylistEntry> collectIncidentClips(const QString& errorLogId) const;
+    /// 다운로드된 클립을 풀의 플레이어에서 열기 (인시던트 클립이 여럿이면 재생 목록)
+    void openPlayer(const QString& httpUrl, const QString& errorLogId, const QString& localPath);
+
+    /// 비디오 목록 항목 데이터 역할
+    enum VideoItemRole {
+        HttpUrlRole = Qt::UserRole,     ///< 비디오 HTTP URL
+        ErrorLogIdRole,                 ///< 에러 로그 ID
+        CreatedTimeRole,                ///< 비디오 생성 시간 (ms)
+        DurationRole                    ///< 비디오 길이 (초)
+    };
 
     // === UI 컴포넌트 ===
     QWidget* m_centralWidget;           ///< 중앙 위젯
@@ -71,14 +95,21 @@ private:
     // === 상태 표시 ===
     QProgressBar* m_progressBar;        ///< 다운로드 진행률 표시
     QLabel* m_statusLabel;              ///< 상태 메시지 표시
+    QLabel* m_resourceLabel;            ///< 플레이어 메모리/디코딩 부하 표시
     
     // === 비즈니스 로직 ===
     VideoClient* m_videoClient;         ///< 서버 통신 클라이언트
-    QList<VideoPlayer*> m_videoPlayers; ///< 열린 비디오 플레이어 창들
+    VideoPlayerPool* m_playerPool;      ///< 열린/대기 중인 비디오 플레이어 창들
+    PlayerGovernor* m_playerGovernor;   ///< 열린 플레이어들의 디코딩 자원 관리
+    VideoListCache m_listCache;         ///< 최근 조회 결과 스냅샷
+    bool m_listIsStale = false;         ///< 현재 목록이 스냅샷에서 온 것인지
+    QElapsedTimer m_startupTimer;       ///< 시작 → 목록 표시 시간 측정
+    int m_queryGeneration = 0;          ///< 마지막 조회 번호 (이전 조회의 늦은 응답 무시)
     
     // === 상수 ===
     static constexpr int DEFAULT_WINDOW_WIDTH = 800;
     static constexpr int DEFAULT_WINDOW_HEIGHT = 600;
     static constexpr int DEFAULT_SEARCH_DAYS = 7;
     static constexpr int MAX_VIDEO_RESULTS = 100;
+    static constexpr int DEFAULT_RANGE_SECONDS = 10;
 };
\ No newline at end of file
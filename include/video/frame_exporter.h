@@ -0,0 +1,107 @@
+#pragma once
+
+#include <QObject>
+#include <QMediaPlayer>
+#include <QVideoSink>
+#include <QVideoFrame>
+#include <QThreadPool>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QVector>
+#include <QString>
+#include <atomic>
+
+/// 프레임 내보내기 설정
+struct FrameExportOptions {
+    enum Mode {
+        Interval,                       ///< 일정 간격마다
+        Burst                           ///< 기준 위치 주변 연속 프레임
+    };
+    
+    Mode mode = Interval;
+    int intervalSeconds = 6;            ///< Interval: 추출 간격 (초)
+    qint64 burstCenterMs = 0;           ///< Burst: 기준 위치
+    int burstCount = 9;                 ///< Burst: 프레임 수
+    int burstSpacingMs = 200;           ///< Burst: 프레임 간격
+    QString format = "png";             ///< "png" 또는 "jpg"
+    int jpegQuality = 90;               ///< JPEG 품질 (0~100)
+    QString outputDir;                  ///< 저장 폴더
+    bool contactSheet = true;           ///< 콘택트 시트 생성 여부
+    int sheetColumns = 5;               ///< 콘택트 시트 열 수
+    qint64 createdTime = 0;             ///< 클립의 video_created_time (ms, 0이면 클립 내 위치로 표시)
+};
+
+/**
+ * @brief 클립에서 프레임을 추출해 이미지와 콘택트 시트로 저장
+ * 
+ * 재생 중인 플레이어와 별도의 헤드리스 QMediaPlayer로 지정 위치를 차례로
+ * 탐색하여 프레임을 받고, 이미지 변환/인코딩은 스레드 풀에서 병렬로
+ * 처리합니다. 모든 프레임이 끝나면 썸네일을 모아 타임스탬프가 들어간
+ * 콘택트 시트를 만듭니다. 재생 창은 멈추지 않습니다.
+ */
+class FrameExporter : public QObject {
+    Q_OBJECT
+
+public:
+    explicit FrameExporter(QObject *parent = nullptr);
+    ~FrameExporter();
+    
+    /// 내보내기 시작 (이미 진행 중이면 false)
+    bool start(const QString& videoPath, const FrameExportOptions& options);
+    /// 진행 중인 내보내기 취소
+    void cancel();
+
+signals:
+    /// 진행률 (저장 완료된 프레임 수 / 전체)
+    void progress(int done, int total);
+    /// 완료 (sheetPath는 콘택트 시트를 만들지 않았으면 빈 문자열)
+    void finished(bool success, int savedFrames, const QString& sheetPath);
+
+private:
+    /// 미디어 로드 완료 후 추출 위치 계산
+    void onMediaStatusChanged(QMediaPlayer::MediaStatus status);
+    /// 탐색 후 도착한 프레임 처리
+    void onVideoFrame(const QVideoFrame& frame);
+    /// 다음 위치로 탐색
+    void seekNext();
+    /// 현재 위치의 프레임을 인코딩 작업으로 넘기고 다음으로 진행
+    void acceptFrame(const QVideoFrame& frame);
+    /// 인코딩 작업 완료 (GUI 스레드)
+    void onFrameEncoded(int index, bool ok, const QImage& thumbnail);
+    /// 콘택트 시트 생성 및 완료 처리
+    void finishExport();
+    /// 프레임 라벨 (video_created_time 기준 시각 또는 클립 내 위치)
+    QString frameLabel(qint64 positionMs) const;
+    /// 출력 파일 경로
+    QString framePath(int index, qint64 positionMs) const;
+    /// 썸네일을 격자로 배치하고 라벨을 그림 (워커 스레드)
+    static QImage composeSheet(const QVector<QImage>& thumbnails, const QStringList& labels, int columns);
+    
+    QMediaPlayer* m_player;             ///< 헤드리스 디코더
+    QVideoSink* m_sink;                 ///< 프레임 수신
+    QTimer m_frameTimeout;              ///< 탐색 후 프레임이 오지 않을 때 대비
+    QThreadPool m_pool;                 ///< 변환/인코딩 작업 풀
+    QElapsedTimer m_timer;              ///< 소요 시간 측정
+    
+    QString m_videoPath;                ///< 대상 클립
+    FrameExportOptions m_options;       ///< 내보내기 설정
+    QVector<qint64> m_positions;        ///< 추출 위치 (ms)
+    QVector<QImage> m_thumbnails;       ///< 위치별 썸네일
+    int m_next = 0;                     ///< 다음으로 탐색할 위치
+    int m_encoded = 0;                  ///< 인코딩 완료된 프레임 수
+    int m_saved = 0;                    ///< 저장 성공한 프레임 수
+    QVideoFrame m_lastFrame;            ///< 탐색 후 마지막으로 받은 프레임
+    bool m_running = false;             ///< 진행 중 여부
+    bool m_seeking = false;             ///< 탐색 결과 대기 중
+    std::atomic<bool> m_cancelled{false};   ///< 취소 요청 (작업 스레드에서 확인)
+    
+    // === 상수 ===
+    static constexpr int FRAME_TIMEOUT_MS = 1500;
+    static constexpr qint64 SEEK_TOLERANCE_MS = 500;
+    static constexpr int THUMBNAIL_WIDTH = 320;
+    static constexpr int SHEET_LABEL_HEIGHT = 20;
+    static constexpr int SHEET_SPACING = 4;
+    static constexpr int MAX_FRAMES = 1000;
+    static constexpr int MAX_IN_FLIGHT_PER_THREAD = 2;
+};
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <QObject>
+#include <QThread>
+#include <QVector>
+#include <QHash>
+#include <QVideoFrame>
+#include <QMediaPlayer>
+#include <QVideoSink>
+#include <QElapsedTimer>
+#include <atomic>
+
+/**
+ * @brief 디코딩된 프레임의 모션 에너지 계산 (워커 스레드에서 실행)
+ * 
+ * 각 프레임의 루마 평면을 64x36 블록 평균으로 축소하고 이전 프레임과의
+ * 절대 차이 평균(SIMD 커널)을 구해 초 단위로 평균낸 신호를 만듭니다.
+ */
+class MotionAnalyzer : public QObject {
+    Q_OBJECT
+
+public:
+    explicit MotionAnalyzer(QObject *parent = nullptr);
+    
+    /// 프레임 하나 처리 (워커 스레드에서 호출)
+    void processFrame(const QVideoFrame& frame);
+    /// 지금까지의 결과를 completed 시그널로 전달
+    void flush();
+    /// 초 단위 모션 에너지 (0~255)
+    QVector<float> energyPerSecond() const;
+    
+    /// 처리 대기 중인 프레임 수 (밀리면 새 프레임은 건너뜀)
+    std::atomic<int> pendingFrames{0};
+    /// 클립 길이 (ms, 0이면 모름) - 초 인덱스 상한
+    std::atomic<qint64> durationMs{0};
+
+signals:
+    /// 중간 결과 (일정 프레임마다)
+    void updated(const QVector<float>& energy);
+    /// 최종 결과
+    void completed(const QVector<float>& energy);
+
+private:
+    /// 프레임을 축소 그리드로 변환
+    bool downscale(const QVideoFrame& frame);
+    
+    QVector<quint8> m_grid;             ///< 현재 프레임 축소 그리드
+    QVector<quint8> m_prevGrid;         ///< 이전 프레임 축소 그리드
+    bool m_hasPrev = false;             ///< 이전 프레임 존재 여부
+    QVector<double> m_sums;             ///< 초별 에너지 합
+    QVector<int> m_counts;              ///< 초별 프레임 수
+    qint64 m_lastTimeUs = -1;           ///< 타임스탬프가 없을 때 추정용
+    qint64 m_firstTimeUs = -1;          ///< 첫 프레임 타임스탬프 (초 인덱스 기준)
+    int m_framesSinceUpdate = 0;        ///< 중간 결과 전달 주기
+    
+    // === 상수 ===
+    static constexpr int GRID_WIDTH = 64;
+    static constexpr int GRID_HEIGHT = 36;
+    static constexpr int ROW_STEP = 2;
+    static constexpr int UPDATE_INTERVAL_FRAMES = 60;
+    static constexpr qint64 DEFAULT_FRAME_US = 33333;
+    static constexpr qint64 MAX_SECONDS = 24 * 3600;    ///< 길이를 모를 때 초 인덱스 상한
+};
+
+/**
+ * @brief 캐시된 클립의 백그라운드 모션 분석 작업
+ * 
+ * 오디오 출력 없이 QVideoSink로만 디코딩하는 QMediaPlayer를 배속 재생하여
+ * 프레임을 MotionAnalyzer(워커 스레드)로 넘깁니다. 결과는 클립 옆
+ * `<clip>.motion` 파일에 저장되어 다시 열 때 바로 사용됩니다.
+ * 동시에 실행되는 작업 수는 제한되며 나머지는 대기열에서 기다립니다.
+ */
+class MotionAnalysisJob : public QObject {
+    Q_OBJECT
+
+public:
+    /// 분석 예약 (캐시가 있으면 nullptr, 이미 진행/대기 중이면 기존 작업)
+    static MotionAnalysisJob* enqueue(const QString& videoPath);
+    /// 캐시된 신호 읽기
+    static bool loadCached(const QString& videoPath, QVector<float>& energy);
+    /// 캐시 파일 경로
+    static QString cachePath(const QString& videoPath);
+    
+    QString videoPath() const { return m_videoPath; }
+
+signals:
+    /// 중간 결과
+    void progress(const QString& videoPath, const QVector<float>& energy);
+    /// 분석 완료 (실패시 빈 신호)
+    void finished(const QString& videoPath, const QVector<float>& energy);
+
+private:
+    explicit MotionAnalysisJob(const QString& videoPath, QObject *parent = nullptr);
+    ~MotionAnalysisJob();
+    
+    /// 디코딩 시작
+    void start();
+    /// 결과 저장 후 정리
+    void complete(const QVector<float>& energy, bool save);
+    /// 디코딩 중지 및 싱크 연결 해제 (분석기로 프레임이 더 가지 않게)
+    void stopDecoding();
+    /// 대기열의 다음 작업 시작
+    static void startPending();
+    static bool saveCached(const QString& videoPath, const QVector<float>& energy);
+    
+    QString m_videoPath;                ///< 분석 대상 파일
+    QThread m_thread;                   ///< 분석 워커 스레드
+    MotionAnalyzer* m_analyzer;         ///< 워커 스레드의 분석기
+    QMediaPlayer* m_player = nullptr;   ///< 헤드리스 디코더
+    QVideoSink* m_sink = nullptr;       ///< 프레임 수신
+    bool m_completed = false;           ///< 완료 여부
+    QElapsedTimer m_timer;              ///< 분석 소요 시간 측정
+    
+    static QHash<QString, MotionAnalysisJob*> s_jobs;   ///< 진행/대기 중인 작업
+    static QList<MotionAnalysisJob*> s_pending;         ///< 시작 대기열
+    static int s_running;                               ///< 실행 중인 작업 수
+    
+    // === 상수 ===
+    static constexpr int MAX_RUNNING_JOBS = 2;
+    static constexpr int MAX_PENDING_FRAMES = 4;
+    static constexpr qreal ANALYSIS_PLAYBACK_RATE = 8.0;
+    static constexpr quint32 CACHE_MAGIC = 0x464D4F54; // "FMOT"
+    static constexpr quint16 CACHE_VERSION = 1;
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <QtGlobal>
+
+/**
+ * @brief 모션 에너지 계산용 SIMD 커널
+ * 
+ * 실행 시 CPU 기능을 확인해 AVX2 → SSE2 → 스칼라 순으로 선택합니다.
+ * ARM(라즈베리파이)에서는 NEON을 사용합니다.
+ */
+namespace MotionKernels {
+
+/// 두 버퍼의 절대 차이 합 (SAD)
+quint64 sumAbsDiff(const quint8* a, const quint8* b, int length);
+/// 버퍼 바이트 합 (축소용 블록 평균)
+quint64 sumBytes(const quint8* data, int length);
+/// 루마 평면을 gridWidth x gridHeight 블록 평균으로 축소 (행은 rowStep 간격으로 샘플링)
+void downscaleLuma(const quint8* plane, int width, int height, int stride,
+                   quint8* grid, int gridWidth, int gridHeight, int rowStep);
+/// 선택된 커널 이름 (로그용)
+const char* activeKernelName();
+
+} // namespace MotionKernels
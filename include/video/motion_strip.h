@@ -0,0 +1,48 @@
+#pragma once
+
+#include <QWidget>
+#include <QList>
+#include <QVector>
+
+/// 통합 타임라인 위 클립 하나의 모션 신호
+struct MotionSegment {
+    qint64 offsetMs = 0;                ///< 타임라인 기준 클립 시작 위치
+    qint64 durationMs = 0;              ///< 클립 길이
+    QVector<float> energy;              ///< 초 단위 모션 에너지 (비어 있으면 분석 전)
+};
+
+/**
+ * @brief 타임라인 슬라이더 위의 모션 에너지 막대
+ * 
+ * 초 단위 모션 에너지를 색으로 표시하고, 급격한 움직임 구간(스파이크)을
+ * 찾아 다음 스파이크로 이동할 수 있게 합니다.
+ */
+class MotionStrip : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit MotionStrip(QWidget *parent = nullptr);
+    
+    /// 표시할 구간 설정 (totalMs: 타임라인 전체 길이)
+    void setSegments(const QList<MotionSegment>& segments, qint64 totalMs);
+    /// afterMs 이후 첫 스파이크 위치 (없으면 -1)
+    qint64 nextSpike(qint64 afterMs) const;
+    /// 분석된 신호가 하나라도 있는지
+    bool hasEnergy() const;
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+
+private:
+    /// 스파이크 판정 기준값 (평균 + 2σ)
+    float spikeThreshold() const;
+    
+    QList<MotionSegment> m_segments;    ///< 클립별 신호
+    qint64 m_totalMs = 0;               ///< 타임라인 전체 길이
+    float m_maxEnergy = 0;              ///< 색 정규화 기준
+    
+    // === 상수 ===
+    static constexpr int STRIP_HEIGHT = 10;
+    static constexpr float MIN_SPIKE_THRESHOLD = 4.0f;
+    static constexpr qint64 MIN_SPIKE_DISTANCE_MS = 500;
+};
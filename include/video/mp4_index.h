@@ -0,0 +1,112 @@
+#pragma once
+
+#include <QByteArray>
+#include <QList>
+#include <QMap>
+#include <QString>
+#include <vector>
+
+/// MP4 샘플 하나 (원본 파일 기준 위치/시간)
+struct Mp4Sample {
+    qint64 offset = 0;                  ///< 원본 파일 내 바이트 위치
+    quint32 size = 0;                   ///< 샘플 크기
+    qint64 dts = 0;                     ///< 디코딩 시간 (트랙 timescale)
+    quint32 duration = 0;               ///< 샘플 길이 (트랙 timescale)
+    qint32 ctsOffset = 0;               ///< 표시 시간 오프셋 (ctts)
+    quint32 descIndex = 1;              ///< 샘플 설명 인덱스 (stsc)
+    bool keyframe = true;               ///< 동기 샘플 여부 (stss)
+};
+
+/// 트랙별 샘플 테이블
+struct Mp4Track {
+    int trakIndex = -1;                 ///< moov 내 trak 순서
+    quint32 trackId = 0;                ///< tkhd track_ID
+    QByteArray handlerType;             ///< "vide", "soun" 등
+    quint32 timescale = 0;              ///< mdhd timescale
+    bool hasCtts = false;               ///< 원본에 ctts가 있었는지
+    bool hasStss = false;               ///< 원본에 stss가 있었는지
+    QList<Mp4Sample> samples;           ///< 디코딩 순서의 샘플들
+    int firstSelected = -1;             ///< 선택 구간 첫 샘플
+    int lastSelected = -1;              ///< 선택 구간 마지막 샘플
+};
+
+/// 원격 파일에서 받아야 할 바이트 구간
+struct Mp4ByteRange {
+    qint64 offset = 0;
+    qint64 length = 0;
+};
+
+/// 최상위 박스 스캔 결과 (moov 위치 찾기)
+struct Mp4TopLevelScan {
+    qint64 moovOffset = -1;             ///< moov 시작 위치 (-1이면 못 찾음)
+    qint64 moovSize = 0;                ///< moov 전체 크기
+    qint64 nextOffset = -1;             ///< 다음으로 읽어야 할 박스 헤더 위치 (-1이면 파일 끝)
+    bool fragmented = false;            ///< moof가 있는 fragmented MP4
+    QByteArray ftyp;                    ///< ftyp 박스 원본 (있으면)
+};
+
+/**
+ * @brief MP4 moov 인덱스 파서 및 부분 리먹서
+ *
+ * moov 박스만으로 샘플 테이블을 복원하여 시간 구간을 원본 파일의 바이트
+ * 구간으로 변환합니다. 받은 구간 데이터로 재인코딩 없이 독립 재생 가능한
+ * 작은 MP4(ftyp + moov + mdat)를 다시 작성합니다.
+ * fragmented MP4(moof/mvex)는 지원하지 않습니다.
+ */
+class Mp4Index {
+public:
+    /// 파일 앞부분(또는 중간 조각)에서 최상위 박스를 훑어 moov 위치 찾기
+    static Mp4TopLevelScan scanTopLevel(const QByteArray& data, qint64 dataOffset);
+    
+    /// moov 박스 전체를 파싱 (fileSize: 원본 파일 크기, 모르면 -1)
+    bool parse(const QByteArray& moov, qint64 fileSize = -1);
+    /// 시간 구간 선택 (비디오 트랙은 이전 키프레임부터 포함)
+    bool selectRange(qint64 startMs, qint64 endMs);
+    /// 선택된 샘플을 덮는 바이트 구간 (mergeGap 이하 간격은 병합)
+    QList<Mp4ByteRange> requiredRanges(qint64 mergeGap) const;
+    /// 받은 구간 데이터로 MP4 파일 작성 (rangeData: 구간 시작 위치 → 데이터)
+    bool writeClip(const QString& path, const QMap<qint64, QByteArray>& rangeData,
+                   const QByteArray& ftyp) const;
+    
+    /// 전체 길이 (ms)
+    qint64 durationMs() const;
+    /// 선택 구간의 실제 시작 시간 (키프레임 기준, ms)
+    qint64 selectedStartMs() const;
+    /// 선택 구간 샘플 데이터 총량
+    qint64 selectedBytes() const;
+    QString errorString() const { return m_error; }
+
+private:
+    /// moov 하위 박스 트리
+    struct Box {
+        QByteArray type;
+        QByteArray payload;             ///< 리프 박스의 내용 (헤더 제외)
+        std::vector<Box> children;      ///< 컨테이너 박스의 하위 박스
+        bool container = false;
+    };
+    
+    static bool parseBoxes(const QByteArray& data, qint64 begin, qint64 end, std::vector<Box>& boxes, int depth);
+    static const Box* findChild(const Box& parent, const char* type);
+    bool parseTrack(const Box& trak, int trakIndex);
+    bool parseSampleTable(const Box& stbl, Mp4Track& track);
+    
+    /// 선택 구간으로 moov 재작성 (trackDataOffsets: 트랙별 mdat 내 청크 위치)
+    QByteArray buildMoov(const QMap<int, qint64>& trackDataOffsets) const;
+    QByteArray buildTrak(const Box& trak, const Mp4Track& track, qint64 chunkOffset) const;
+    QByteArray buildStbl(const Box& stbl, const Mp4Track& track, qint64 chunkOffset) const;
+    static QByteArray serialize(const Box& box);
+    const Mp4Track* trackForTrak(int trakIndex) const;
+    const Mp4Track* primaryTrack() const;
+    quint64 selectedMediaDuration(const Mp4Track& track) const;
+    
+    Box m_moov;                         ///< 파싱된 moov 트리
+    QList<Mp4Track> m_tracks;           ///< 트랙별 샘플 테이블
+    quint32 m_movieTimescale = 0;       ///< mvhd timescale
+    quint64 m_movieDuration = 0;        ///< mvhd duration
+    qint64 m_fileSize = -1;             ///< 원본 파일 크기 (샘플 테이블 검증용)
+    QString m_error;                    ///< 마지막 오류 메시지
+    
+    // === 상수 ===
+    static constexpr int MAX_BOX_DEPTH = 8;
+    static constexpr qint64 MAX_SAMPLES = 10000000;    ///< 트랙당 샘플 수 상한 (60fps 약 46시간)
+};
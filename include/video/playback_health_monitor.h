@@ -0,0 +1,90 @@
+#pragma once
+
+#include <QObject>
+#include <QMediaPlayer>
+#include <QVideoSink>
+#include <QVideoFrame>
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QTimer>
+#include <QFile>
+#include <atomic>
+
+/**
+ * @brief 재생 상태 측정 (표시 FPS, 누락/지연 프레임, 버퍼, 탐색 지연)
+ * 
+ * 비디오 싱크의 프레임 시그널을 직접 연결(디코더 스레드 가능)로 받아
+ * 원자 카운터만 갱신하며, 프레임마다 할당하거나 매핑하지 않습니다.
+ * 재생 중에만 주기적으로 GUI 스레드에서 카운터를 샘플링해 요약 문자열을 만들고
+ * 세션 로그 파일에 한 줄씩 기록합니다.
+ * 
+ * - 누락 프레임: 연속 프레임 타임스탬프 간격이 프레임 길이의 1.5배를 넘는 경우
+ * - 지연 프레임: 도착 간격이 (타임스탬프 간격 / 재생 속도)의 2배를 넘는 경우
+ * - 탐색 지연: markSeek() 호출부터 다음 프레임 도착까지
+ */
+class PlaybackHealthMonitor : public QObject {
+    Q_OBJECT
+
+public:
+    explicit PlaybackHealthMonitor(const QString& playerName, QObject *parent = nullptr);
+    
+    /// 측정 대상 플레이어/싱크 지정 (재생 목록 전환시 다시 호출)
+    void attach(QMediaPlayer* player, QVideoSink* sink);
+    /// 탐색 요청 시점 기록
+    void markSeek();
+    /// 카운터 초기화 (새 비디오를 열 때)
+    void resetCounters();
+    /// 샘플링 정지 (플레이어 초기화/해제 시, 다음 재생 시작 때 다시 시작됨)
+    void stop();
+    /// 마지막 샘플 요약
+    QString summary() const { return m_summary; }
+    /// 세션 로그에 한 줄 기록 (GUI 스레드)
+    void logEvent(const QString& line);
+    
+    /// 멀티미디어 백엔드 이름 (QT_MEDIA_BACKEND가 없으면 "(expected)"가 붙은 추정값)
+    static QString backendName();
+    /// 세션 로그 파일 경로
+    static QString sessionLogPath();
+
+signals:
+    /// 새 샘플 (summary() 갱신됨)
+    void sampled(const QString& summary);
+
+private:
+    /// 프레임 도착 처리 (디코더 스레드에서 호출될 수 있음)
+    void onFrame(const QVideoFrame& frame);
+    /// 카운터 샘플링 및 로그 기록 (GUI 스레드)
+    void sample();
+    /// 재생 시작 시 샘플링 타이머 시작
+    void startSampling();
+    /// 환경 변수/플랫폼으로 백엔드 이름 결정 (backendName()이 한 번만 호출)
+    static QString detectBackendName();
+    
+    QString m_playerName;                       ///< 로그에 표시할 플레이어 이름
+    QPointer<QMediaPlayer> m_player;            ///< 측정 중인 플레이어
+    QPointer<QVideoSink> m_sink;                ///< 측정 중인 싱크
+    QElapsedTimer m_clock;                      ///< 도착 시각 기준
+    QTimer m_sampleTimer;                       ///< 샘플링 주기
+    QString m_summary;                          ///< 마지막 요약
+    
+    // === 프레임 스레드에서 갱신되는 카운터 ===
+    std::atomic<qint64> m_frames{0};            ///< 표시된 프레임 수
+    std::atomic<qint64> m_dropped{0};           ///< 누락 추정 프레임 수
+    std::atomic<qint64> m_late{0};              ///< 늦게 도착한 프레임 수
+    std::atomic<qint64> m_lastTimestampUs{-1};  ///< 직전 프레임 타임스탬프
+    std::atomic<qint64> m_lastArrivalNs{-1};    ///< 직전 프레임 도착 시각
+    std::atomic<qint64> m_seekStartNs{-1};      ///< 진행 중인 탐색 시작 시각
+    std::atomic<qint64> m_seekLatencyNs{-1};    ///< 마지막 탐색 지연
+    std::atomic<int> m_rateMilli{1000};         ///< 재생 속도 x1000
+    std::atomic<int> m_frameWidth{0};           ///< 프레임 크기
+    std::atomic<int> m_frameHeight{0};
+    
+    // === 샘플링 상태 ===
+    qint64 m_lastSampleFrames = 0;              ///< 직전 샘플의 프레임 수
+    qint64 m_lastSampleNs = 0;                  ///< 직전 샘플 시각
+    bool m_wasPlaying = false;                  ///< 직전 샘플에서 재생 중이었는지
+    
+    // === 상수 ===
+    static constexpr int SAMPLE_INTERVAL_MS = 1000;
+    static constexpr qint64 DEFAULT_FRAME_US = 33333;
+};
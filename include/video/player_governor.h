@@ -0,0 +1,78 @@
+#pragma once
+
+#include <QObject>
+#include <QHash>
+#include <QTimer>
+#include <QElapsedTimer>
+#include "videoplayer.h"
+
+/// 플레이어 자원 사용 현황
+struct PlayerResourceStats {
+    int trackedPlayers = 0;             ///< 열린 플레이어 창 수
+    int decodingPlayers = 0;            ///< 재생(디코딩) 중인 플레이어 수
+    int suspendedPlayers = 0;           ///< 디코더를 해제한 플레이어 수
+    qint64 residentBytes = -1;          ///< 프로세스 메모리 사용량 (-1이면 알 수 없음)
+    double cpuPercent = -1;             ///< 프로세스 CPU 사용률 (전체 코어 기준, -1이면 알 수 없음)
+};
+
+/**
+ * @brief 열린 VideoPlayer 창들의 디코딩 자원 관리
+ * 
+ * 숨겨지거나 최소화된 창은 재생을 멈추고 미디어 소스를 해제하여 디코더와
+ * 프레임 버퍼를 반납하며, 다시 표시되면 같은 위치에서 이어 재생합니다.
+ * 동시에 디코딩하는 플레이어 수가 상한을 넘으면 가장 오래 사용하지 않은
+ * 창부터 일시정지합니다. 주기적으로 메모리와 디코딩 부하를 보고합니다.
+ */
+class PlayerGovernor : public QObject {
+    Q_OBJECT
+
+public:
+    explicit PlayerGovernor(int maxDecoding = DEFAULT_MAX_DECODING, QObject *parent = nullptr);
+    
+    /// 플레이어 관리 시작 (창을 연 직후)
+    void track(VideoPlayer* player);
+    /// 플레이어 관리 종료 (창이 닫혀 풀로 반환될 때)
+    void untrack(VideoPlayer* player);
+    
+    int maxDecoding() const { return m_maxDecoding; }
+    /// 현재 자원 사용 현황
+    PlayerResourceStats stats() const;
+    
+    /// 설정(player/maxDecoding)에서 동시 디코딩 상한 읽기
+    static int configuredMaxDecoding();
+
+signals:
+    /// 주기적 자원 사용 보고
+    void statsUpdated(const PlayerResourceStats& stats);
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    /// 재생 상태 변경시 동시 디코딩 상한 적용
+    void onPlayingChanged(VideoPlayer* player, bool playing);
+    /// 창 표시 상태에 따라 디코더 해제/복원
+    void updateVisibility(VideoPlayer* player);
+    /// 최근 사용 순서 갱신
+    void touch(VideoPlayer* player);
+    /// 현황 계산 후 statsUpdated 발생
+    void report();
+    /// 프로세스 상주 메모리 (바이트)
+    static qint64 residentMemory();
+    /// 프로세스 누적 CPU 시간 (ms)
+    static qint64 processCpuTimeMs();
+    
+    int m_maxDecoding;                              ///< 동시 디코딩 상한
+    QHash<VideoPlayer*, quint64> m_lastUsed;        ///< 플레이어별 마지막 사용 순번
+    quint64 m_useCounter = 0;                       ///< 사용 순번 증가값
+    QTimer m_reportTimer;                           ///< 보고 주기
+    QElapsedTimer m_wallClock;                      ///< CPU 사용률 계산용 실제 시간
+    qint64 m_lastCpuMs = -1;                        ///< 직전 보고 시점의 CPU 시간
+    qint64 m_lastWallMs = 0;                        ///< 직전 보고 시점의 실제 시간
+    double m_cpuPercent = -1;                       ///< 마지막 CPU 사용률
+    
+    // === 상수 ===
+    static constexpr int DEFAULT_MAX_DECODING = 4;
+    static constexpr int MAX_DECODING_LIMIT = 32;
+    static constexpr int REPORT_INTERVAL_MS = 2000;
+};
@@ -9,19 +9,84 @@
 #include <QSlider>
 #include <QLabel>
 #include <QFileInfo>
+#include <QElapsedTimer>
+#include <QStackedLayout>
+#include <QList>
+#include <QSet>
+#include <QHash>
+#include <QVector>
+#include <functional>
+
+class MotionStrip;
+class FrameExporter;
+class PlaybackHealthMonitor;
+
+/// 재생 목록의 클립 하나
+struct PlaylistEntry {
+    QString httpUrl;                    ///< 원격 URL (아직 받지 않았으면 fetcher로 다운로드)
+    QString localPath;                  ///< 로컬 캐시 경로 (비어 있으면 미다운로드)
+    qint64 durationMs = 0;              ///< 클립 길이 (로드 후 실제 값으로 갱신)
+    qint64 createdTime = 0;             ///< video_created_time (ms)
+};
+
+using PlaylistFetchDone = std::function<void(bool success, const QString& localPath)>;
+/// 재생 목록 클립을 로컬 캐시로 받아오는 함수 (VideoClient::downloadVideo 래핑)
+/// urgent: 사용자가 기다리는 클립이면 true, 미리 받기면 false
+using PlaylistFetcher = std::function<void(const QString& httpUrl, bool urgent, PlaylistFetchDone done)>;
 
 /**
  * @brief 독립적인 비디오 재생 창
  * 
  * 로컬 비디오 파일을 재생하는 별도의 창입니다.
  * 기본적인 재생 컨트롤(재생/일시정지, 시간 슬라이더)을 제공합니다.
+ * 빈 상태로 미리 생성해 두었다가 openVideo()/reset()으로 재사용할 수 있습니다.
+ * 
+ * 재생 목록 모드에서는 같은 인시던트의 클립들을 하나의 타임라인으로 이어서
+ * 재생합니다. 다음 클립을 미리 받아 대기 플레이어에 로드해 두고, 현재 클립이
+ * 끝나면 출력 위젯만 교체하여 끊김 없이 넘어갑니다.
+ * 
+ * 슬라이더 위에는 백그라운드에서 분석한 모션 에너지 막대가 표시되며,
+ * 다음 급격한 움직임 구간으로 바로 이동할 수 있습니다.
+ * 현재 클립의 프레임을 이미지와 콘택트 시트로 내보낼 수 있습니다.
+ * F3으로 재생 상태(표시 FPS, 누락/지연 프레임, 버퍼, 탐색 지연, 백엔드)를 표시합니다.
  */
 class VideoPlayer : public QWidget {
     Q_OBJECT
 
 public:
+    /// 비디오 없이 위젯 트리와 미디어 플레이어만 생성 (풀에서 사전 생성용)
+    explicit VideoPlayer(QWidget *parent = nullptr);
     explicit VideoPlayer(const QString& videoPath, QWidget *parent = nullptr);
     ~VideoPlayer();
+    
+    /// 비디오 파일 열기 및 재생 시작 (파일이 없으면 false)
+    bool openVideo(const QString& videoPath, qint64 createdTime = 0, qint64 startPositionMs = 0);
+    /// 재생 목록 열기 (startIndex 클립은 로컬에 받아져 있어야 함)
+    bool openPlaylist(const QList<PlaylistEntry>& entries, int startIndex, PlaylistFetcher fetcher,
+                      qint64 startPositionMs = 0);
+    /// 재생 중지 및 소스 해제 (재사용 전 초기화)
+    void reset();
+    /// 현재 열린 비디오 경로
+    QString videoPath() const { return m_videoPath; }
+    
+    /// 일시정지
+    void pause();
+    /// 재생을 멈추고 미디어 소스를 해제 (위치와 재생 상태는 기억)
+    void suspend();
+    /// suspend() 이전 위치/상태로 복원
+    void resume();
+    bool isSuspended() const { return m_suspended; }
+    /// 디코딩(재생) 중인지
+    bool isPlaying() const;
+
+signals:
+    /// 사용자가 창을 닫았을 때 (풀 반환용)
+    void closed(VideoPlayer* player);
+    /// 재생 시작/정지 (PlayerGovernor의 동시 디코딩 제한용)
+    void playingChanged(VideoPlayer* player, bool playing);
+
+protected:
+    void closeEvent(QCloseEvent* event) override;
 
 private slots:
     /// 재생/일시정지 버튼 클릭 처리
@@ -36,6 +101,14 @@ private slots:
     void onMediaStatusChanged(QMediaPlayer::MediaStatus status);
     /// 에러 발생 처리
     void onErrorOccurred(QMediaPlayer::Error error, const QString& errorString);
+    /// 다음 모션 스파이크로 이동
+    void onNextSpikeClicked();
+    /// 프레임 내보내기 설정 창 표시 및 시작
+    void onExportClicked();
+    /// 재생 상태 표시 켜기/끄기 (F3)
+    void onHealthToggled();
+    /// 백그라운드 모션 분석 결과 수신
+    void onMotionEnergyUpdated(const QString& videoPath, const QVector<float>& energy);
 
 private:
     /// UI 컴포넌트 초기화
@@ -44,22 +117,87 @@ private:
     void setupConnections();
     /// 시간 형식 변환 (ms -> MM:SS)
     QString formatTime(qint64 timeMs) const;
-    /// 비디오 로드 및 재생 시작
-    void loadAndPlayVideo();
-
+    /// 첫 프레임 표시 시점 기록 (열기 지연 측정)
+    void onFirstFrame();
+    
+    // === 재생 목록 ===
+    /// 활성 플레이어에 클립 로드 (받지 않은 클립이면 다운로드 후 로드)
+    void loadClip(int index, qint64 positionMs, bool autoplay);
+    /// 클립 다운로드 요청 (중복 요청 무시)
+    void fetchClip(int index);
+    /// 다음 클립을 받아 대기 플레이어에 미리 로드
+    void prefetchNext();
+    /// 대기 플레이어에 클립 로드 후 일시정지 상태로 준비
+    void preloadStandby(int index);
+    /// 대기 플레이어로 출력 전환 (끊김 없는 클립 전환)
+    void switchToStandby(bool autoplay);
+    /// 대기 플레이어/위젯 생성
+    void ensureStandby();
+    /// 활성 플레이어 시그널 연결/해제
+    void connectActivePlayer();
+    void disconnectActivePlayer();
+    /// 클립 시작 위치 (통합 타임라인 기준 ms)
+    qint64 clipOffset(int index) const;
+    /// 재생 목록 전체 길이 (ms)
+    qint64 totalDuration() const;
+    /// 통합 타임라인 위치에 해당하는 클립 인덱스
+    int clipIndexAt(qint64 timelineMs, qint64* positionInClip) const;
+    /// 슬라이더 범위를 전체 길이로 갱신
+    void updateTimelineRange();
+    /// 창 제목을 현재 클립으로 갱신
+    void updateWindowTitle();
+    /// 통합 타임라인 위치로 이동 (슬라이더 이동과 동일)
+    void seekTimeline(qint64 timelineMs);
+    
+    // === 모션 에너지 ===
+    /// 캐시된 신호를 읽거나 분석 예약
+    void requestMotionAnalysis(const QString& videoPath);
+    /// 모션 막대를 현재 재생 목록으로 갱신
+    void updateMotionStrip();
+    
     // === UI 컴포넌트 ===
     QVBoxLayout* m_mainLayout;          ///< 메인 레이아웃
     QHBoxLayout* m_controlsLayout;      ///< 컨트롤 레이아웃
     
-    QVideoWidget* m_videoWidget;        ///< 비디오 출력 위젯
-    QMediaPlayer* m_mediaPlayer;        ///< Qt6 미디어 플레이어
+    QStackedLayout* m_videoStack;       ///< 활성/대기 비디오 위젯 전환
+    QVideoWidget* m_videoWidget;        ///< 비디오 출력 위젯 (활성)
+    QMediaPlayer* m_mediaPlayer;        ///< Qt6 미디어 플레이어 (활성)
+    QVideoWidget* m_standbyWidget = nullptr;   ///< 다음 클립용 출력 위젯
+    QMediaPlayer* m_standbyPlayer = nullptr;   ///< 다음 클립을 미리 로드하는 플레이어
     
     QPushButton* m_playPauseBtn;        ///< 재생/일시정지 버튼
     QSlider* m_positionSlider;          ///< 재생 위치 슬라이더
+    MotionStrip* m_motionStrip;         ///< 슬라이더 위 모션 에너지 막대
+    QPushButton* m_nextSpikeBtn;        ///< 다음 스파이크 이동 버튼
+    QPushButton* m_exportBtn;           ///< 프레임 내보내기 버튼
+    QPushButton* m_healthBtn;           ///< 재생 상태 표시 버튼
+    QLabel* m_healthLabel;              ///< 재생 상태 표시 (FPS, 누락 프레임 등)
     QLabel* m_timeLabel;                ///< 시간 표시 레이블
     
     // === 데이터 ===
     QString m_videoPath;                ///< 비디오 파일 경로
+    QElapsedTimer m_openTimer;          ///< 열기 → 첫 프레임 시간 측정
+    bool m_waitingFirstFrame = false;   ///< 첫 프레임 대기 중 여부
+    
+    // === 재생 목록 ===
+    QList<PlaylistEntry> m_playlist;    ///< 재생 목록 (단일 파일은 항목 1개)
+    PlaylistFetcher m_fetcher;          ///< 클립 다운로드 함수
+    int m_currentIndex = -1;            ///< 활성 플레이어의 클립
+    int m_standbyIndex = -1;            ///< 대기 플레이어에 로드된 클립
+    int m_pendingIndex = -1;            ///< 다운로드 완료를 기다리는 클립
+    qint64 m_pendingPosition = 0;       ///< 대기 클립 로드 후 이동할 위치
+    bool m_pendingAutoplay = false;     ///< 대기 클립 로드 후 재생 여부
+    qint64 m_seekOnLoad = -1;           ///< 로드 완료 후 이동할 위치
+    QSet<int> m_fetching;               ///< 다운로드 중인 클립
+    int m_playlistGeneration = 0;       ///< 재사용 후 늦게 도착한 콜백 무시용
+    QHash<QString, QVector<float>> m_motionEnergy;  ///< 클립 경로별 모션 신호
+    FrameExporter* m_frameExporter = nullptr;       ///< 프레임 내보내기 (처음 사용할 때 생성)
+    PlaybackHealthMonitor* m_health = nullptr;      ///< 재생 상태 측정 및 세션 로그
+    
+    // === 자원 해제 상태 ===
+    bool m_suspended = false;           ///< 소스를 해제한 상태
+    qint64 m_suspendedPosition = 0;     ///< 해제 시점의 타임라인 위치
+    bool m_resumePlaying = false;       ///< 복원 후 재생 여부
     
     // === 상수 ===
     static constexpr int DEFAULT_WINDOW_WIDTH = 800;
@@ -69,4 +207,7 @@ private:
     static constexpr int CONTROL_BUTTON_WIDTH = 40;
     static constexpr int CONTROL_BUTTON_HEIGHT = 30;
     static constexpr int TIME_LABEL_MIN_WIDTH = 80;
+    static constexpr int DEFAULT_EXPORT_INTERVAL_SECONDS = 6;
+    static constexpr int DEFAULT_BURST_COUNT = 9;
+    static constexpr int DEFAULT_BURST_SPACING_MS = 200;
 };
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <QObject>
+#include <QList>
+#include "videoplayer.h"
+
+/**
+ * @brief 사전 초기화된 VideoPlayer 인스턴스 풀
+ * 
+ * 시작 후 백그라운드에서 VideoPlayer를 미리 생성해 두고(멀티미디어 백엔드
+ * 초기화 포함), 창이 닫히면 파괴하지 않고 초기화 후 풀에 반환합니다.
+ * 첫 번째 열기에서도 위젯 트리/QMediaPlayer 생성 비용을 피할 수 있습니다.
+ */
+class VideoPlayerPool : public QObject {
+    Q_OBJECT
+
+public:
+    explicit VideoPlayerPool(int poolSize = DEFAULT_POOL_SIZE, QObject *parent = nullptr);
+    ~VideoPlayerPool();
+
+    /// 이벤트 루프가 돌기 시작한 뒤 한 틱에 하나씩 인스턴스 생성
+    void warmUp(int delayMs = DEFAULT_WARMUP_DELAY_MS);
+    /// 유휴 인스턴스 가져오기 (없으면 새로 생성)
+    VideoPlayer* acquire();
+    /// 인스턴스를 초기화하고 풀에 반환 (풀이 가득 차면 삭제)
+    void release(VideoPlayer* player);
+
+    int poolSize() const { return m_poolSize; }
+    int idleCount() const { return m_idlePlayers.size(); }
+    int activeCount() const { return m_activePlayers.size(); }
+    const QList<VideoPlayer*>& activePlayers() const { return m_activePlayers; }
+
+    /// 설정(player/poolSize)에서 풀 크기 읽기
+    static int configuredPoolSize();
+
+signals:
+    /// 사용 중이던 플레이어가 닫혀 풀로 반환됨
+    void playerReleased(VideoPlayer* player);
+
+private:
+    /// 풀이 찰 때까지 인스턴스 하나 생성 후 다음 틱 예약
+    void warmUpNext();
+    /// 사전 초기화된 인스턴스 생성
+    VideoPlayer* createPlayer();
+
+    int m_poolSize;                         ///< 유지할 유휴 인스턴스 수
+    QList<VideoPlayer*> m_idlePlayers;      ///< 재사용 대기 중인 플레이어
+    QList<VideoPlayer*> m_activePlayers;    ///< 사용 중인 플레이어
+
+    // === 상수 ===
+    static constexpr int DEFAULT_POOL_SIZE = 2;
+    static constexpr int MAX_POOL_SIZE = 8;
+    static constexpr int DEFAULT_WARMUP_DELAY_MS = 500;
+};
@@ -0,0 +1,176 @@
+#include "../../include/core/clip_cache.h"
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QLockFile>
+#include <QSaveFile>
+#include <QSettings>
+#include <QStandardPaths>
+#include <QDebug>
+
+ClipCache::ClipCache(const QString& directory)
+    : m_directory(directory)
+{
+}
+
+ClipCache::~ClipCache() {
+    // 끝나지 않은 다운로드는 버리고 잠금 해제 (기다리던 인스턴스가 이어받음)
+    for (auto it = m_locks.constBegin(); it != m_locks.constEnd(); ++it) {
+        QFile::remove(partPathFor(it.key()));
+    }
+    qDeleteAll(m_locks);
+}
+
+QString ClipCache::defaultDirectory() {
+    // 사용자별 임시 디렉토리를 쓰는 OS에서는 공용 경로를 설정해야 사용자 간에 공유됨
+    QSettings settings;
+    QString dir = settings.value("cache/sharedDir").toString();
+    if (dir.isEmpty()) {
+        dir = QStandardPaths::writableLocation(QStandardPaths::TempLocation) + "/factory_videos";
+    }
+    return dir;
+}
+
+bool ClipCache::ensureDirectory() const {
+    QDir dir(m_directory);
+    if (dir.exists()) {
+        return true;
+    }
+    if (!dir.mkpath(".")) {
+        qWarning() << "Cannot create clip cache:" << m_directory;
+        return false;
+    }
+    
+    // 다른 사용자의 인스턴스도 잠금/파일을 만들 수 있도록
+    QFile::setPermissions(m_directory, QFileDevice::ReadOwner | QFileDevice::WriteOwner | QFileDevice::ExeOwner
+                                     | QFileDevice::ReadGroup | QFileDevice::WriteGroup | QFileDevice::ExeGroup
+                                     | QFileDevice::ReadOther | QFileDevice::WriteOther | QFileDevice::ExeOther);
+    return true;
+}
+
+ClipCache::Claim ClipCache::claim(const QString& fileName) {
+    // 이 인스턴스가 이미 받는 중
+    if (m_locks.contains(fileName)) {
+        return Busy;
+    }
+    
+    // 완료된 파일만 최종 경로에 존재
+    QFileInfo cached(pathFor(fileName));
+    if (cached.exists() && cached.size() > 0) {
+        return Hit;
+    }
+    
+    QLockFile* lock = new QLockFile(pathFor(fileName) + ".lock");
+    // 다운로드가 오래 걸려도 stale로 보지 않음 (소유 프로세스가 죽은 경우만 stale)
+    lock->setStaleLockTime(0);
+    if (!lock->tryLock(0)) {
+        QLockFile::LockError error = lock->error();
+        delete lock;
+        if (error == QLockFile::LockFailedError) {
+            return Busy;
+        }
+        qWarning() << "Cannot lock clip" << fileName << "in" << m_directory << "(error" << error << ")";
+        return Failed;
+    }
+    
+    // 확인과 잠금 사이에 다른 인스턴스가 완료했을 수 있음
+    cached.refresh();
+    if (cached.exists() && cached.size() > 0) {
+        delete lock;
+        return Hit;
+    }
+    
+    // 죽은 프로세스가 남긴 .part는 다른 사용자 소유일 수 있으므로 덮어쓰지 않고 삭제
+    QFile::remove(partPathFor(fileName));
+    m_locks.insert(fileName, lock);
+    return Acquired;
+}
+
+bool ClipCache::finish(const QString& fileName, bool success) {
+    QLockFile* lock = m_locks.take(fileName);
+    if (!lock) {
+        return false;
+    }
+    
+    // 잠금을 가진 동안 최종 경로는 비어 있으므로 이름 변경만으로 완성된 파일이 나타남
+    QString partPath = partPathFor(fileName);
+    QString localPath = pathFor(fileName);
+    // 빈 .part는 touch()로 만든 진행 표시일 뿐이므로 옮기지 않음
+    if (success && QFileInfo(partPath).size() > 0) {
+        QFile::remove(localPath);
+        success = QFile::rename(partPath, localPath);
+    }
+    QFile::remove(partPath);
+    
+    // 구간 파일처럼 최종 경로에 바로 쓰는 경우도 결과 파일로 확인
+    success = success && QFileInfo(localPath).size() > 0;
+    delete lock;
+    return success;
+}
+
+bool ClipCache::writeMetadata(const QString& fileName, const QByteArray& data) const {
+    // 최종 파일보다 먼저 원자적으로 써 두므로 Hit 시점에는 항상 읽을 수 있음
+    QSaveFile file(pathFor(fileName) + ".meta");
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(data);
+    return file.commit();
+}
+
+QByteArray ClipCache::metadata(const QString& fileName) const {
+    QFile file(pathFor(fileName) + ".meta");
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+    return file.readAll();
+}
+
+qint64 ClipCache::inProgressBytes(const QString& fileName) const {
+    QFileInfo part(partPathFor(fileName));
+    return part.exists() ? part.size() : 0;
+}
+
+qint64 ClipCache::lastActivityMs(const QString& fileName) const {
+    QFileInfo part(partPathFor(fileName));
+    return part.exists() ? part.lastModified().toMSecsSinceEpoch() : 0;
+}
+
+void ClipCache::touch(const QString& fileName) const {
+    if (!m_locks.contains(fileName)) return;
+    
+    QFile part(partPathFor(fileName));
+    if (part.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        part.setFileTime(QDateTime::currentDateTimeUtc(), QFileDevice::FileModificationTime);
+    }
+}
+
+void ClipCache::clear() {
+    QDir dir(m_directory);
+    const QStringList files = dir.entryList(QDir::Files);
+    int kept = 0;
+    
+    for (const QString& file : files) {
+        if (file.endsWith(".lock")) continue;
+        
+        QString clipName = (file.endsWith(".part") || file.endsWith(".meta")) ? file.chopped(5) : file;
+        if (m_locks.contains(clipName)) {
+            ++kept;
+            continue;
+        }
+        
+        // 다른 인스턴스가 받는 중이면 유지
+        QLockFile lock(pathFor(clipName) + ".lock");
+        lock.setStaleLockTime(0);
+        if (!lock.tryLock(0)) {
+            ++kept;
+            continue;
+        }
+        dir.remove(file);
+    }
+    
+    if (kept > 0) {
+        qDebug() << "Clip cache cleared," << kept << "files in use by other downloads kept";
+    }
+}
@@ -4,6 +4,8 @@
 int main(int argc, char *argv[])
 {
     QApplication app(argc, argv);
+    app.setOrganizationName("Factory");
+    app.setApplicationName("VideoClient");
     
     MainWindow window;
     window.show();
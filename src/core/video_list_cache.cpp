@@ -0,0 +1,117 @@
+#include "../../include/core/video_list_cache.h"
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QDebug>
+
+VideoListCache::VideoListCache(const QString& filePath)
+    : m_filePath(filePath)
+{
+}
+
+QString VideoListCache::defaultPath() {
+    QString dir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (dir.isEmpty()) {
+        dir = QStandardPaths::writableLocation(QStandardPaths::TempLocation) + "/factory_videos";
+    }
+    return dir + "/video_list.snapshot";
+}
+
+bool VideoListCache::load(QList<VideoInfo>& videos, qint64* savedAtMs) const {
+    QFile file(m_filePath);
+    if (!file.open(QIODevice::ReadOnly) || file.size() <= 0) {
+        return false;
+    }
+    
+    // 메모리 매핑으로 복사 없이 읽기 (매핑 실패시 일반 읽기)
+    QByteArray buffer;
+    uchar* mapped = file.map(0, file.size());
+    if (mapped) {
+        buffer = QByteArray::fromRawData(reinterpret_cast<const char*>(mapped), file.size());
+    } else {
+        buffer = file.readAll();
+    }
+    
+    QDataStream in(buffer);
+    in.setVersion(QDataStream::Qt_6_0);
+    
+    quint32 magic = 0;
+    quint16 version = 0;
+    qint64 savedAt = 0;
+    quint32 count = 0;
+    in >> magic >> version >> savedAt >> count;
+    
+    if (magic != FILE_MAGIC || version != FILE_VERSION || in.status() != QDataStream::Ok) {
+        qWarning() << "Invalid video list snapshot:" << m_filePath;
+        return false;
+    }
+    
+    // 손상된 헤더로 큰 할당을 하지 않도록 남은 바이트로 가능한 개수만 허용
+    qint64 remaining = buffer.size() - in.device()->pos();
+    if (count > remaining / MIN_RECORD_BYTES) {
+        qWarning() << "Corrupt video list snapshot (count" << count << "):" << m_filePath;
+        return false;
+    }
+    
+    QList<VideoInfo> result;
+    result.reserve(count);
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        VideoInfo video;
+        qint32 duration = 0;
+        in >> video.video_id
+           >> video.error_log_id
+           >> video.device_id
+           >> video.http_url
+           >> video.file_path
+           >> duration
+           >> video.file_size
+           >> video.video_created_time
+           >> video.video_quality;
+        video.video_duration = duration;
+        result.append(video);
+    }
+    
+    if (in.status() != QDataStream::Ok) {
+        qWarning() << "Truncated video list snapshot:" << m_filePath;
+        return false;
+    }
+    
+    videos = result;
+    if (savedAtMs) *savedAtMs = savedAt;
+    return true;
+}
+
+bool VideoListCache::save(const QList<VideoInfo>& videos) const {
+    QDir().mkpath(QFileInfo(m_filePath).absolutePath());
+    
+    QSaveFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Cannot write video list snapshot:" << m_filePath;
+        return false;
+    }
+    
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_6_0);
+    out << FILE_MAGIC
+        << FILE_VERSION
+        << QDateTime::currentMSecsSinceEpoch()
+        << static_cast<quint32>(videos.size());
+    
+    for (const auto& video : videos) {
+        out << video.video_id
+            << video.error_log_id
+            << video.device_id
+            << video.http_url
+            << video.file_path
+            << static_cast<qint32>(video.video_duration)
+            << video.file_size
+            << video.video_created_time
+            << video.video_quality;
+    }
+    
+    return file.commit();
+}
@@ -0,0 +1,166 @@
+#include "../../include/network/bandwidth_governor.h"
+#include <QSettings>
+#include <QStringList>
+#include <QDebug>
+#include <limits>
+
+BandwidthGovernor::BandwidthGovernor(QObject *parent)
+    : QObject(parent)
+    , m_tickTimer(new QTimer(this))
+{
+    m_tickTimer->setInterval(TICK_INTERVAL_MS);
+    connect(m_tickTimer, &QTimer::timeout, this, &BandwidthGovernor::onTick);
+    
+    reloadSettings();
+}
+
+void BandwidthGovernor::reloadSettings() {
+    QSettings settings;
+    m_defaultLimits[Interactive] = settings.value("bandwidth/interactiveKBps", 0).toLongLong() * 1024;
+    m_defaultLimits[Background] = settings.value("bandwidth/backgroundKBps", 0).toLongLong() * 1024;
+    
+    // "08:00-18:00=2048/256" (시간대=대화형/백그라운드 KB/s)
+    m_schedule.clear();
+    const QStringList entries = settings.value("bandwidth/schedule").toStringList();
+    for (const QString& entry : entries) {
+        QStringList parts = entry.split('=');
+        QStringList times = parts.value(0).split('-');
+        QStringList limits = parts.value(1).split('/');
+        
+        ScheduleEntry schedule;
+        schedule.start = QTime::fromString(times.value(0).trimmed(), "HH:mm");
+        schedule.end = QTime::fromString(times.value(1).trimmed(), "HH:mm");
+        schedule.limits[Interactive] = limits.value(0).trimmed().toLongLong() * 1024;
+        schedule.limits[Background] = limits.value(1, limits.value(0)).trimmed().toLongLong() * 1024;
+        
+        if (parts.size() != 2 || !schedule.start.isValid() || !schedule.end.isValid()) {
+            qWarning() << "Invalid bandwidth schedule entry:" << entry;
+            continue;
+        }
+        m_schedule.append(schedule);
+    }
+    
+    updateRates();
+}
+
+qint64 BandwidthGovernor::currentLimit(TrafficClass trafficClass) const {
+    QTime now = QTime::currentTime();
+    for (const ScheduleEntry& entry : m_schedule) {
+        // 자정을 넘는 구간 (예: 22:00-06:00) 지원
+        bool inside = entry.start <= entry.end
+            ? (now >= entry.start && now < entry.end)
+            : (now >= entry.start || now < entry.end);
+        if (inside) {
+            return entry.limits[trafficClass];
+        }
+    }
+    return m_defaultLimits[trafficClass];
+}
+
+void BandwidthGovernor::updateRates() {
+    for (int cls = Interactive; cls <= Background; ++cls) {
+        m_buckets[cls].rate = currentLimit(static_cast<TrafficClass>(cls));
+    }
+}
+
+void BandwidthGovernor::attach(QNetworkReply* reply, TrafficClass trafficClass, DataSink sink, DoneHandler done) {
+    // 작은 읽기 버퍼: 가득 차면 소켓 읽기가 멈춰 서버 쪽 전송도 느려짐
+    reply->setReadBufferSize(READ_BUFFER_SIZE);
+    
+    Stream stream;
+    stream.reply = reply;
+    stream.trafficClass = trafficClass;
+    stream.sink = sink;
+    stream.done = done;
+    m_streams.append(stream);
+    
+    connect(reply, &QNetworkReply::readyRead, this, [this, trafficClass]() {
+        // 제한이 없으면 바로 전달, 있으면 다음 틱까지 대기
+        if (m_buckets[trafficClass].rate == 0) {
+            drainClass(trafficClass);
+        }
+    });
+    connect(reply, &QNetworkReply::finished, this, [this, reply]() {
+        for (Stream& s : m_streams) {
+            if (s.reply == reply) s.networkFinished = true;
+        }
+        drainClass(Interactive);
+        drainClass(Background);
+        completeFinishedStreams();
+    });
+    
+    if (!m_tickTimer->isActive()) {
+        m_clock.start();
+        m_tickTimer->start();
+    }
+}
+
+void BandwidthGovernor::onTick() {
+    double elapsed = m_clock.restart() / 1000.0;
+    updateRates();
+    
+    for (int cls = Interactive; cls <= Background; ++cls) {
+        Bucket& bucket = m_buckets[cls];
+        if (bucket.rate > 0) {
+            double burst = qMax<double>(bucket.rate * BURST_SECONDS, 1024);
+            bucket.tokens = qMin(burst, bucket.tokens + bucket.rate * elapsed);
+        }
+        drainClass(static_cast<TrafficClass>(cls));
+    }
+    
+    completeFinishedStreams();
+    
+    if (m_streams.isEmpty()) {
+        m_tickTimer->stop();
+    }
+}
+
+void BandwidthGovernor::drainClass(TrafficClass trafficClass) {
+    Bucket& bucket = m_buckets[trafficClass];
+    
+    QList<int> ready;
+    for (int i = 0; i < m_streams.size(); ++i) {
+        const Stream& s = m_streams[i];
+        if (s.trafficClass == trafficClass && s.reply && s.reply->bytesAvailable() > 0) {
+            ready.append(i);
+        }
+    }
+    if (ready.isEmpty()) return;
+    
+    // 같은 종류의 스트림끼리 토큰을 균등 분배
+    qint64 share = bucket.rate == 0
+        ? std::numeric_limits<qint64>::max()
+        : static_cast<qint64>(bucket.tokens / ready.size());
+    if (share <= 0) return;
+    
+    for (int index : ready) {
+        Stream& s = m_streams[index];
+        qint64 bytes = qMin(share, s.reply->bytesAvailable());
+        QByteArray data = s.reply->read(bytes);
+        if (bucket.rate > 0) {
+            bucket.tokens -= data.size();
+        }
+        if (s.sink && !data.isEmpty()) {
+            s.sink(data);
+        }
+    }
+}
+
+void BandwidthGovernor::completeFinishedStreams() {
+    // done 핸들러에서 reply가 삭제될 수 있으므로 먼저 목록에서 분리
+    QList<DoneHandler> completed;
+    for (int i = m_streams.size() - 1; i >= 0; --i) {
+        const Stream& s = m_streams[i];
+        bool drained = !s.reply || s.reply->bytesAvailable() == 0;
+        if (s.networkFinished && drained) {
+            completed.prepend(s.done);
+            m_streams.removeAt(i);
+        } else if (!s.reply) {
+            m_streams.removeAt(i);
+        }
+    }
+    
+    for (const DoneHandler& done : completed) {
+        if (done) done();
+    }
+}
@@ -0,0 +1,224 @@
+#include "../../include/network/io_worker.h"
+#include "../../include/network/range_fetcher.h"
+#include <QNetworkRequest>
+#include <QNetworkReply>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QLocale>
+#include <QTimer>
+#include <QDebug>
+
+IoWorker::IoWorker(const QString& cacheDir, QObject *parent)
+    : QObject(parent)
+    , m_clipCache(cacheDir)
+{
+}
+
+void IoWorker::initialize() {
+    // 이 스레드에 속하도록 스레드 시작 후 생성
+    m_networkManager = new QNetworkAccessManager(this);
+    m_bandwidthGovernor = new BandwidthGovernor(this);
+    m_mqttClient = new MqttClient(this);
+    
+    m_clipCache.ensureDirectory();
+    
+    // MQTT 연결
+    m_mqttClient->connectToHost();
+}
+
+void IoWorker::queryVideos(const QString& device_id, const QString& error_log_id,
+                           qint64 start_time, qint64 end_time, int limit,
+                           VideoQueryCallback callback) {
+    m_mqttClient->queryVideos(device_id, error_log_id, start_time, end_time, limit, callback);
+}
+
+void IoWorker::queryVideosStreaming(const QString& device_id, const QString& error_log_id,
+                                    qint64 start_time, qint64 end_time, int limit,
+                                    VideoQueryStreamCallback callback) {
+    m_mqttClient->queryVideosStreaming(device_id, error_log_id, start_time, end_time, limit, callback);
+}
+
+void IoWorker::download(const QString& http_url, BandwidthGovernor::TrafficClass trafficClass,
+                        VideoDownloadCallback callback, ProgressHandler progress, StatusHandler status) {
+    // 파일명 추출
+    QString fileName = http_url.split('/').last();
+    QString localPath = m_clipCache.pathFor(fileName);
+    
+    ClipCache::Claim claim = m_clipCache.claim(fileName);
+    if (claim != ClipCache::Busy) {
+        m_cacheWaits.remove(fileName);
+    }
+    
+    switch (claim) {
+    case ClipCache::Hit:
+        // 캐시 적중: 완료된 파일만 최종 경로에 존재하므로 바로 사용
+        if (status) status(QString("Cached: %1").arg(fileName));
+        if (callback) callback(true, localPath);
+        return;
+    case ClipCache::Busy:
+        // 다른 인스턴스가 받는 중이면 같은 파일을 다시 받지 않고 완료를 기다림
+        if (!otherDownloadAlive(fileName, progress, status)) {
+            if (status) status(QString("Other download stalled: %1").arg(fileName));
+            if (callback) callback(false, "");
+            return;
+        }
+        QTimer::singleShot(CACHE_POLL_INTERVAL_MS, this, [=]() {
+            download(http_url, trafficClass, callback, progress, status);
+        });
+        return;
+    case ClipCache::Failed:
+        if (callback) callback(false, "");
+        return;
+    case ClipCache::Acquired:
+        break;
+    }
+    
+    // 받는 중인 데이터는 .part 파일에 쓰고 완료 후 이름 변경
+    QFile* file = new QFile(m_clipCache.partPathFor(fileName));
+    if (!file->open(QIODevice::WriteOnly)) {
+        m_clipCache.finish(fileName, false);
+        if (callback) callback(false, "");
+        delete file;
+        return;
+    }
+    
+    QNetworkRequest request(http_url);
+    request.setRawHeader("User-Agent", "Factory Video Client");
+    
+    QNetworkReply* reply = m_networkManager->get(request);
+    
+    if (status) status(QString("Downloading: %1").arg(fileName));
+    
+    if (progress) {
+        connect(reply, &QNetworkReply::downloadProgress, this, progress);
+    }
+    
+    // 데이터 수신 및 완료 처리 (대역폭 제한기가 읽기 속도 조절)
+    m_bandwidthGovernor->attach(reply, trafficClass,
+        [file](const QByteArray& data) {
+            file->write(data);
+        },
+        [this, reply, file, fileName, localPath, callback, status]() {
+            file->close();
+            delete file;
+            
+            bool success = m_clipCache.finish(fileName, reply->error() == QNetworkReply::NoError);
+            
+            if (status) status(success ? "Download completed" : "Download failed");
+            if (callback) callback(success, success ? localPath : "");
+            
+            reply->deleteLater();
+        });
+}
+
+void IoWorker::fetchRange(const QString& http_url, qint64 start_ms, qint64 end_ms,
+                          VideoRangeCallback callback, ProgressHandler progress, StatusHandler status) {
+    QString fileName = http_url.split('/').last();
+    QString rangeName = QString("%1_%2-%3.mp4")
+        .arg(QFileInfo(fileName).completeBaseName())
+        .arg(start_ms)
+        .arg(end_ms);
+    QString localPath = m_clipCache.pathFor(rangeName);
+    
+    ClipCache::Claim claim = m_clipCache.claim(rangeName);
+    if (claim != ClipCache::Busy) {
+        m_cacheWaits.remove(rangeName);
+    }
+    
+    switch (claim) {
+    case ClipCache::Hit:
+        // 같은 구간을 이미 받았으면 바로 사용 (키프레임 앞부분 길이는 .meta에 저장됨)
+        if (callback) callback(true, localPath, m_clipCache.metadata(rangeName).trimmed().toLongLong());
+        return;
+    case ClipCache::Busy:
+        if (!otherDownloadAlive(rangeName, progress, status)) {
+            if (status) status(QString("Other download stalled: %1").arg(rangeName));
+            if (callback) callback(false, "", 0);
+            return;
+        }
+        QTimer::singleShot(CACHE_POLL_INTERVAL_MS, this, [=]() {
+            fetchRange(http_url, start_ms, end_ms, callback, progress, status);
+        });
+        return;
+    case ClipCache::Failed:
+        if (callback) callback(false, "", 0);
+        return;
+    case ClipCache::Acquired:
+        break;
+    }
+    
+    RangeFetcher* fetcher = new RangeFetcher(m_networkManager, m_bandwidthGovernor,
+                                             http_url, start_ms, end_ms, localPath, this);
+    
+    if (progress) {
+        connect(fetcher, &RangeFetcher::progress, this, progress);
+    }
+    // 구간 데이터는 메모리에 모았다가 한 번에 쓰므로, 기다리는 인스턴스를 위해 진행 중임을 표시
+    connect(fetcher, &RangeFetcher::progress, this, [this, rangeName]() {
+        m_clipCache.touch(rangeName);
+    });
+    
+    connect(fetcher, &RangeFetcher::finished, this,
+        [this, fetcher, http_url, start_ms, rangeName, callback, progress, status](bool success, const QString& path, const QString& error) {
+            fetcher->deleteLater();
+            
+            // 클립은 요청 시작 이전 키프레임부터 시작하므로 요청 구간까지의 길이를 함께 저장
+            qint64 leadInMs = success ? qMax<qint64>(0, start_ms - fetcher->selectedStartMs()) : 0;
+            if (success) {
+                m_clipCache.writeMetadata(rangeName, QByteArray::number(leadInMs));
+            }
+            // 구간 파일은 QSaveFile로 최종 경로에 원자적으로 쓰임
+            success = m_clipCache.finish(rangeName, success);
+            
+            if (success) {
+                if (status) {
+                    status(QString("Range fetched (%1 transferred)")
+                           .arg(QLocale().formattedDataSize(fetcher->bytesReceived())));
+                }
+                if (callback) callback(true, path, leadInMs);
+                return;
+            }
+            
+            // Range/moov 방식이 불가능하면 전체 파일 다운로드로 대체 (요청 구간은 start_ms부터)
+            qWarning() << "Range fetch failed, downloading whole file:" << error;
+            download(http_url, BandwidthGovernor::Interactive,
+                [callback, start_ms](bool downloaded, const QString& wholePath) {
+                    if (callback) callback(downloaded, wholePath, downloaded ? start_ms : 0);
+                }, progress, status);
+        });
+    
+    fetcher->start();
+}
+
+bool IoWorker::otherDownloadAlive(const QString& fileName, ProgressHandler progress, StatusHandler status) {
+    bool started = !m_cacheWaits.contains(fileName);
+    CacheWait& wait = m_cacheWaits[fileName];
+    if (started && status) {
+        status(QString("Waiting for other download: %1").arg(fileName));
+    }
+    
+    // .part 크기나 수정 시각이 바뀌면 진행 중 (전체 크기는 알 수 없음)
+    qint64 bytes = m_clipCache.inProgressBytes(fileName);
+    qint64 activityMs = m_clipCache.lastActivityMs(fileName);
+    if (started || bytes != wait.bytes || activityMs != wait.activityMs) {
+        wait.bytes = bytes;
+        wait.activityMs = activityMs;
+        wait.idle.start();
+        if (progress) progress(bytes, 0);
+        return true;
+    }
+    
+    // 잠금을 가진 프로세스가 살아 있어도 전송이 멈췄으면 더 기다리지 않음
+    if (wait.idle.elapsed() < CACHE_STALL_TIMEOUT_MS) {
+        return true;
+    }
+    qWarning() << "Other instance's download of" << fileName << "stalled for" << wait.idle.elapsed() << "ms";
+    m_cacheWaits.remove(fileName);
+    return false;
+}
+
+void IoWorker::clearCache() {
+    // 공유 캐시이므로 다른 인스턴스가 받는 중인 파일은 남김
+    m_clipCache.clear();
+}
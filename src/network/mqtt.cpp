@@ -1,40 +1,165 @@
 #include "../../include/network/mqtt.h"
 #include <QJsonArray>
 #include <QDateTime>
+#include <QElapsedTimer>
+#include <QSettings>
 #include <QDebug>
 #include <QtMqtt/QMqttTopicFilter>
 #include <QtMqtt/QMqttTopicName>
+#include <algorithm>
+#include <queue>
+#include <utility>
+
+#ifdef VIDEO_CLIENT_HAS_ZLIB
+#include <zlib.h>
+#endif
 
 MqttClient::MqttClient(QObject *parent)
     : QObject(parent)
-    , m_client(new QMqttClient(this))
-    , m_timeoutTimer(new QTimer(this))
 {
-    m_client->setHostname("mqtt.kwon.pics");
-    m_client->setPort(1883);
-    
-    connect(m_client, &QMqttClient::connected, this, &MqttClient::onConnected);
-    connect(m_client, &QMqttClient::messageReceived, this, &MqttClient::onMessageReceived);
+    // 응답 형식 협상 (서버가 지원하지 않으면 JSON으로 응답하며 그대로 처리됨)
+    QSettings settings;
+    m_responseFormat = settings.value("mqtt/responseFormat", "cbor").toString();
+    m_compression = settings.value("mqtt/compression", "deflate").toString();
+#ifndef VIDEO_CLIENT_HAS_ZLIB
+    // 크기 제한 있는 압축 해제가 불가능하면 압축 응답을 요청하지 않음
+    m_compression = "none";
+#endif
+    m_defaultTimeoutMs = settings.value("mqtt/brokerTimeoutMs", DEFAULT_BROKER_TIMEOUT_MS).toInt();
     
-    m_timeoutTimer->setSingleShot(true);
-    m_timeoutTimer->setInterval(10000); // 10초 타임아웃
+    // 라인별 브로커마다 클라이언트 하나
+    const QList<MqttBrokerEndpoint> endpoints = configuredBrokers();
+    for (int i = 0; i < endpoints.size(); ++i) {
+        Broker broker;
+        broker.endpoint = endpoints[i];
+        broker.client = new QMqttClient(this);
+        broker.client->setHostname(broker.endpoint.host);
+        broker.client->setPort(broker.endpoint.port);
+        
+        // 연결이 끊기면 다음 쿼리를 기다리지 않고 재연결 시도
+        broker.reconnectTimer = new QTimer(this);
+        broker.reconnectTimer->setSingleShot(true);
+        broker.reconnectTimer->setInterval(RECONNECT_INTERVAL_MS);
+        QMqttClient* client = broker.client;
+        connect(broker.reconnectTimer, &QTimer::timeout, this, [client]() {
+            if (client->state() == QMqttClient::Disconnected) {
+                client->connectToHost();
+            }
+        });
+        connect(broker.client, &QMqttClient::stateChanged, broker.reconnectTimer,
+                [timer = broker.reconnectTimer](QMqttClient::ClientState state) {
+            if (state == QMqttClient::Disconnected) {
+                timer->start();
+            }
+        });
+        
+        connect(broker.client, &QMqttClient::connected, this, [this, i]() {
+            onConnected(i);
+        });
+        connect(broker.client, &QMqttClient::messageReceived, this,
+                [this, i](const QByteArray& message, const QMqttTopicName& topic) {
+            onMessageReceived(i, message, topic);
+        });
+        m_brokers.append(broker);
+    }
 }
 
 MqttClient::~MqttClient() {
-    if (m_client->state() == QMqttClient::Connected) {
-        m_client->disconnectFromHost();
+    for (const Broker& broker : m_brokers) {
+        broker.reconnectTimer->stop();
+        disconnect(broker.client, nullptr, broker.reconnectTimer, nullptr);
+        if (broker.client->state() == QMqttClient::Connected) {
+            broker.client->disconnectFromHost();
+        }
+    }
+}
+
+QList<MqttBrokerEndpoint> MqttClient::configuredBrokers() {
+    QSettings settings;
+    const QString spec = settings.value("mqtt/brokers", "mqtt.kwon.pics:1883").toString();
+    
+    QList<MqttBrokerEndpoint> endpoints;
+    for (const QString& entry : spec.split(',', Qt::SkipEmptyParts)) {
+        QString address = entry.trimmed();
+        MqttBrokerEndpoint endpoint;
+        
+        // host:port/timeoutMs
+        int slash = address.indexOf('/');
+        if (slash >= 0) {
+            endpoint.timeoutMs = address.mid(slash + 1).toInt();
+            address = address.left(slash);
+        }
+        int colon = address.lastIndexOf(':');
+        if (colon > 0) {
+            bool ok = false;
+            int port = address.mid(colon + 1).toInt(&ok);
+            if (!ok || port <= 0 || port > 65535) {
+                qWarning() << "Invalid MQTT broker port:" << entry;
+                continue;
+            }
+            endpoint.port = static_cast<quint16>(port);
+            address = address.left(colon);
+        }
+        if (address.isEmpty()) {
+            qWarning() << "Invalid MQTT broker:" << entry;
+            continue;
+        }
+        endpoint.host = address;
+        endpoints.append(endpoint);
+    }
+    
+    if (endpoints.isEmpty()) {
+        endpoints.append(MqttBrokerEndpoint{"mqtt.kwon.pics", 1883, 0});
     }
+    return endpoints;
 }
 
 void MqttClient::connectToHost() {
-    if (m_client->state() != QMqttClient::Connected) {
-        m_client->connectToHost();
+    for (const Broker& broker : m_brokers) {
+        if (broker.client->state() == QMqttClient::Disconnected) {
+            broker.client->connectToHost();
+        }
+    }
+}
+
+void MqttClient::onConnected(int brokerIndex) {
+    Broker& broker = m_brokers[brokerIndex];
+    qDebug() << "MQTT Connected:" << broker.endpoint.host << broker.endpoint.port;
+    broker.reconnectTimer->stop();
+    broker.client->subscribe(QMqttTopicFilter("factory/query/videos/response"), 1);
+    
+    // 연결 전에 쌓인 쿼리 전송 (기한이 지나거나 끝난 쿼리는 이미 제거됨)
+    const auto pending = std::exchange(broker.pendingPublishes, {});
+    for (const auto& query : pending) {
+        broker.client->publish(QMqttTopicName("factory/query/videos/request"), query.second, 1);
     }
 }
 
-void MqttClient::onConnected() {
-    qDebug() << "MQTT Connected";
-    m_client->subscribe(QMqttTopicFilter("factory/query/videos/response"), 1);
+void MqttClient::publish(int brokerIndex, const QString& query_id, const QByteArray& payload) {
+    Broker& broker = m_brokers[brokerIndex];
+    if (broker.client->state() != QMqttClient::Connected) {
+        // 브로커가 오래 내려가 있어도 대기열이 무한히 늘지 않도록 가장 오래된 쿼리부터 버림
+        if (broker.pendingPublishes.size() >= MAX_PENDING_PUBLISHES) {
+            qWarning() << "MQTT broker" << broker.endpoint.host << broker.endpoint.port
+                       << "offline, dropping queued query" << broker.pendingPublishes.first().first;
+            broker.pendingPublishes.removeFirst();
+        }
+        broker.pendingPublishes.append({query_id, payload});
+        if (broker.client->state() == QMqttClient::Disconnected) {
+            broker.client->connectToHost();
+        }
+        return;
+    }
+    broker.client->publish(QMqttTopicName("factory/query/videos/request"), payload, 1);
+}
+
+void MqttClient::dropPendingPublishes(const QString& query_id, int brokerIndex) {
+    for (int i = 0; i < m_brokers.size(); ++i) {
+        if (brokerIndex >= 0 && i != brokerIndex) continue;
+        m_brokers[i].pendingPublishes.removeIf([&query_id](const QPair<QString, QByteArray>& query) {
+            return query.first == query_id;
+        });
+    }
 }
 
 void MqttClient::queryVideos(const QString& device_id, 
@@ -44,15 +169,25 @@ void MqttClient::queryVideos(const QString& device_id,
                             int limit,
                             VideoQueryCallback callback) {
     
-    if (m_client->state() != QMqttClient::Connected) {
-        connectToHost();
-        QTimer::singleShot(2000, [=]() {
-            queryVideos(device_id, error_log_id, start_time, end_time, limit, callback);
-        });
-        return;
-    }
+    // 모든 브로커의 결과가 모인 뒤 한 번만 호출
+    queryVideosStreaming(device_id, error_log_id, start_time, end_time, limit,
+                         [callback](const QList<VideoInfo>& videos, const VideoQueryProgress& progress) {
+        if (progress.complete && callback) {
+            callback(videos);
+        }
+    });
+}
+
+void MqttClient::queryVideosStreaming(const QString& device_id,
+                                      const QString& error_log_id,
+                                      qint64 start_time,
+                                      qint64 end_time,
+                                      int limit,
+                                      VideoQueryStreamCallback callback) {
     
-    QString query_id = QString("video_query_%1").arg(QDateTime::currentMSecsSinceEpoch());
+    QString query_id = QString("video_query_%1_%2")
+        .arg(QDateTime::currentMSecsSinceEpoch())
+        .arg(++m_querySequence);
     
     QJsonObject query;
     query["query_id"] = query_id;
@@ -69,43 +204,218 @@ void MqttClient::queryVideos(const QString& device_id,
     }
     filters["limit"] = limit;
     query["filters"] = filters;
+    query["format"] = m_responseFormat;
+    if (m_compression != "none") {
+        query["compression"] = m_compression;
+    }
     
-    if (callback) {
-        m_pendingQueries[query_id] = callback;
+    const int count = m_brokers.size();
+    FanOutQuery& pending = m_queries[query_id];
+    pending.callback = callback;
+    pending.limit = limit;
+    pending.states.fill(Pending, count);
+    pending.results.resize(count);
+    pending.deadlines.reserve(count);
+    for (const Broker& broker : m_brokers) {
+        int timeoutMs = broker.endpoint.timeoutMs > 0 ? broker.endpoint.timeoutMs : m_defaultTimeoutMs;
+        pending.deadlines.append(QDeadlineTimer(timeoutMs));
     }
+    pending.elapsed.start();
+    
+    // 느린 라인이 전체를 막지 않도록 기한이 지난 브로커는 건너뜀
+    pending.deadlineTimer = new QTimer(this);
+    pending.deadlineTimer->setSingleShot(true);
+    connect(pending.deadlineTimer, &QTimer::timeout, this, [this, query_id]() {
+        checkDeadlines(query_id);
+    });
     
-    QJsonDocument doc(query);
-    m_client->publish(QMqttTopicName("factory/query/videos/request"), doc.toJson(), 1);
+    QByteArray payload = QJsonDocument(query).toJson(QJsonDocument::Compact);
+    for (int i = 0; i < count; ++i) {
+        publish(i, query_id, payload);
+    }
+    checkDeadlines(query_id);
     
-    qDebug() << "Published query:" << query_id;
+    qDebug() << "Published query:" << query_id << "to" << count << "brokers";
 }
 
-void MqttClient::onMessageReceived(const QByteArray &message, const QMqttTopicName &topic) {
+void MqttClient::checkDeadlines(const QString& query_id) {
+    auto it = m_queries.find(query_id);
+    if (it == m_queries.end()) return;
+    FanOutQuery& query = it.value();
+    
+    bool expired = false;
+    qint64 nextMs = -1;
+    for (int i = 0; i < query.states.size(); ++i) {
+        if (query.states[i] != Pending) continue;
+        
+        if (query.deadlines[i].hasExpired()) {
+            query.states[i] = TimedOut;
+            expired = true;
+            dropPendingPublishes(query_id, i);
+            qWarning() << "MQTT broker" << m_brokers[i].endpoint.host << m_brokers[i].endpoint.port
+                       << "timed out for" << query_id << "after" << query.elapsed.elapsed() << "ms";
+        } else {
+            qint64 remaining = query.deadlines[i].remainingTime();
+            nextMs = nextMs < 0 ? remaining : qMin(nextMs, remaining);
+        }
+    }
+    
+    if (nextMs >= 0) {
+        query.deadlineTimer->start(static_cast<int>(nextMs));
+    }
+    if (expired) {
+        deliver(query_id);
+    }
+}
+
+void MqttClient::onMessageReceived(int brokerIndex, const QByteArray &message, const QMqttTopicName &topic) {
     if (topic.name() != "factory/query/videos/response") return;
     
-    QJsonParseError error;
-    QJsonDocument doc = QJsonDocument::fromJson(message, &error);
-    if (error.error != QJsonParseError::NoError) {
-        qWarning() << "JSON parse error:" << error.errorString();
+    QElapsedTimer timer;
+    timer.start();
+    VideoQueryResponse response;
+    QString format;
+    bool parsed = parseResponse(message, response, format);
+    qint64 parseNsecs = timer.nsecsElapsed();
+    
+    if (!parsed) {
+        qWarning() << "Response parse error (" << format << "," << message.size() << "bytes)";
         return;
     }
+    recordParseTime(format, message.size(), response.data.size(), parseNsecs);
     
-    QJsonObject response = doc.object();
-    QString query_id = response["query_id"].toString();
-    QString status = response["status"].toString();
+    auto it = m_queries.find(response.query_id);
+    if (it == m_queries.end()) return;
+    FanOutQuery& query = it.value();
+    // 기한이 지난 뒤 도착한 응답은 이미 결과에서 제외됨
+    if (query.states[brokerIndex] != Pending) return;
     
-    if (!m_pendingQueries.contains(query_id)) return;
+    const MqttBrokerEndpoint& endpoint = m_brokers[brokerIndex].endpoint;
+    if (response.status != "success") {
+        qWarning() << "Query failed on" << endpoint.host << endpoint.port << ":" << response.error;
+        query.states[brokerIndex] = Failed;
+    } else {
+        qDebug() << "Received" << response.data.size() << "videos for query" << response.query_id
+                 << "from" << endpoint.host << endpoint.port << "in" << query.elapsed.elapsed() << "ms";
+        // 병합 전제: 브로커별 목록은 생성 시각 내림차순
+        std::stable_sort(response.data.begin(), response.data.end(),
+                         [](const VideoInfo& a, const VideoInfo& b) {
+            return a.video_created_time > b.video_created_time;
+        });
+        query.results[brokerIndex] = std::move(response.data);
+        query.states[brokerIndex] = Answered;
+    }
+    
+    deliver(response.query_id);
+}
+
+VideoQueryProgress MqttClient::progressOf(const FanOutQuery& query) {
+    VideoQueryProgress progress;
+    progress.total = query.states.size();
+    for (BrokerState state : query.states) {
+        if (state == Answered) ++progress.answered;
+        else if (state == Failed) ++progress.failed;
+        else if (state == TimedOut) ++progress.timedOut;
+    }
+    progress.complete = progress.answered + progress.failed + progress.timedOut == progress.total;
+    return progress;
+}
+
+void MqttClient::deliver(const QString& query_id) {
+    auto it = m_queries.find(query_id);
+    if (it == m_queries.end()) return;
     
-    VideoQueryCallback callback = m_pendingQueries.take(query_id);
+    VideoQueryProgress progress = progressOf(it.value());
+    QList<VideoInfo> merged = mergeByCreatedTime(it->results, it->limit);
+    VideoQueryStreamCallback callback = it->callback;
     
-    if (status != "success") {
-        qWarning() << "Query failed:" << response["error"].toString();
-        callback(QList<VideoInfo>());
-        return;
+    if (progress.complete) {
+        qDebug() << "Query" << query_id << "complete in" << it->elapsed.elapsed() << "ms:"
+                 << progress.answered << "answered," << progress.failed << "failed,"
+                 << progress.timedOut << "timed out," << merged.size() << "videos";
+        it->deadlineTimer->deleteLater();
+        m_queries.erase(it);
+        dropPendingPublishes(query_id);
     }
     
-    QList<VideoInfo> videos;
-    QJsonArray data = response["data"].toArray();
+    // 콜백이 새 쿼리를 보낼 수 있으므로 m_queries 정리 후 호출
+    if (callback) {
+        callback(merged, progress);
+    }
+}
+
+QList<VideoInfo> MqttClient::mergeByCreatedTime(const QVector<QList<VideoInfo>>& lists, int limit) {
+    // (목록 번호, 목록 내 위치) — 각 목록의 현재 머리를 힙에 두고 가장 최신 것부터 꺼냄
+    using Cursor = std::pair<int, qsizetype>;
+    auto later = [&lists](const Cursor& a, const Cursor& b) {
+        return lists[a.first][a.second].video_created_time < lists[b.first][b.second].video_created_time;
+    };
+    std::priority_queue<Cursor, std::vector<Cursor>, decltype(later)> heap(later);
+    
+    qsizetype total = 0;
+    for (int i = 0; i < lists.size(); ++i) {
+        if (!lists[i].isEmpty()) {
+            heap.push({i, 0});
+            total += lists[i].size();
+        }
+    }
+    
+    QList<VideoInfo> merged;
+    merged.reserve(limit > 0 ? qMin<qsizetype>(limit, total) : total);
+    while (!heap.empty() && (limit <= 0 || merged.size() < limit)) {
+        Cursor top = heap.top();
+        heap.pop();
+        merged.append(lists[top.first][top.second]);
+        if (top.second + 1 < lists[top.first].size()) {
+            heap.push({top.first, top.second + 1});
+        }
+    }
+    return merged;
+}
+
+bool MqttClient::parseResponse(const QByteArray& message, VideoQueryResponse& response, QString& format) {
+    QByteArray payload = message;
+    QString compression;
+    
+    // zlib 헤더 (CMF 0x78, 헤더 체크섬이 31의 배수)
+    if (payload.size() >= 2 && quint8(payload[0]) == 0x78
+        && ((quint8(payload[0]) << 8) | quint8(payload[1])) % 31 == 0) {
+        payload = inflate(payload);
+        compression = "+deflate";
+        if (payload.isEmpty()) {
+            format = "deflate";
+            return false;
+        }
+    }
+    
+    // JSON은 '{'(공백 허용)로 시작, 그 외는 CBOR 맵
+    int first = 0;
+    while (first < payload.size() && QChar::isSpace(uchar(payload[first]))) {
+        ++first;
+    }
+    if (first < payload.size() && payload[first] == '{') {
+        format = "json" + compression;
+        return parseJsonResponse(payload, response);
+    }
+    format = "cbor" + compression;
+    return parseCborResponse(payload, response);
+}
+
+bool MqttClient::parseJsonResponse(const QByteArray& message, VideoQueryResponse& response) {
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(message, &error);
+    if (error.error != QJsonParseError::NoError) {
+        qWarning() << "JSON parse error:" << error.errorString();
+        return false;
+    }
+    
+    QJsonObject root = doc.object();
+    response.query_id = root["query_id"].toString();
+    response.status = root["status"].toString();
+    response.error = root["error"].toString();
+    
+    QJsonArray data = root["data"].toArray();
+    response.data.reserve(data.size());
     
     for (const auto& item : data) {
         QJsonObject obj = item.toObject();
@@ -119,18 +429,170 @@ void MqttClient::onMessageReceived(const QByteArray &message, const QMqttTopicNa
         video.file_size = obj["file_size"].toVariant().toLongLong();
         video.video_created_time = obj["video_created_time"].toVariant().toLongLong();
         video.video_quality = obj["video_quality"].toString();
-        
-        // 디버그: MQTT 응답에서 파싱된 HTTP URL 출력
-        qDebug() << "[DEBUG] Parsed from MQTT response:";
-        qDebug() << "  - Video ID:" << video.video_id;
-        qDebug() << "  - Device ID:" << video.device_id;
-        qDebug() << "  - File Path:" << video.file_path;
-        qDebug() << "  - HTTP URL:" << video.http_url;
-        qDebug() << "  - Raw JSON http_url:" << obj["http_url"];
-        
-        videos.append(video);
+        response.data.append(video);
+    }
+    return true;
+}
+
+bool MqttClient::parseCborResponse(const QByteArray& message, VideoQueryResponse& response) {
+    QCborStreamReader reader(message);
+    
+    // 선택적 self-describe 태그 (0xD9D9F7)
+    if (reader.isTag() && reader.toTag() == QCborTag(QCborKnownTags::Signature)) {
+        reader.next();
+    }
+    if (!reader.isMap()) {
+        qWarning() << "CBOR parse error: response is not a map";
+        return false;
     }
     
-    qDebug() << "Received" << videos.size() << "videos for query" << query_id;
-    callback(videos);
-}
\ No newline at end of file
+    reader.enterContainer();
+    while (reader.lastError() == QCborError::NoError && reader.hasNext()) {
+        QString key = readCborString(reader);
+        if (key == "query_id") {
+            response.query_id = readCborString(reader);
+        } else if (key == "status") {
+            response.status = readCborString(reader);
+        } else if (key == "error") {
+            response.error = readCborString(reader);
+        } else if (key == "data" && reader.isArray()) {
+            // 배열 길이는 네트워크 값이므로 작은 상한까지만 미리 할당하고 나머지는 append로 확장
+            if (reader.isLengthKnown()) {
+                response.data.reserve(static_cast<qsizetype>(
+                    qMin<quint64>(reader.length(), MAX_RESERVED_ROWS)));
+            }
+            reader.enterContainer();
+            while (reader.lastError() == QCborError::NoError && reader.hasNext()) {
+                // 맵이 아닌 행은 readCborVideo가 건너뜀
+                VideoInfo video;
+                if (!readCborVideo(reader, video)) continue;
+                response.data.append(video);
+            }
+            if (reader.lastError() == QCborError::NoError) {
+                reader.leaveContainer();
+            }
+        } else {
+            reader.next();
+        }
+    }
+    if (reader.lastError() == QCborError::NoError) {
+        reader.leaveContainer();
+    }
+    
+    if (reader.lastError() != QCborError::NoError) {
+        qWarning() << "CBOR parse error:" << reader.lastError().toString();
+        return false;
+    }
+    return true;
+}
+
+bool MqttClient::readCborVideo(QCborStreamReader& reader, VideoInfo& video) {
+    if (!reader.isMap()) {
+        reader.next();
+        return false;
+    }
+    
+    video.video_duration = 0;
+    video.file_size = 0;
+    video.video_created_time = 0;
+    
+    reader.enterContainer();
+    while (reader.lastError() == QCborError::NoError && reader.hasNext()) {
+        QString key = readCborString(reader);
+        if (key == "_id") video.video_id = readCborString(reader);
+        else if (key == "error_log_id") video.error_log_id = readCborString(reader);
+        else if (key == "device_id") video.device_id = readCborString(reader);
+        else if (key == "http_url") video.http_url = readCborString(reader);
+        else if (key == "file_path") video.file_path = readCborString(reader);
+        else if (key == "video_duration") video.video_duration = static_cast<int>(readCborInteger(reader));
+        else if (key == "file_size") video.file_size = readCborInteger(reader);
+        else if (key == "video_created_time") video.video_created_time = readCborInteger(reader);
+        else if (key == "video_quality") video.video_quality = readCborString(reader);
+        else reader.next();
+    }
+    if (reader.lastError() != QCborError::NoError) return false;
+    return reader.leaveContainer();
+}
+
+QString MqttClient::readCborString(QCborStreamReader& reader) {
+    if (!reader.isString()) {
+        reader.next();
+        return QString();
+    }
+    
+    // 청크 단위 문자열도 이어 붙임
+    QString result;
+    auto chunk = reader.readString();
+    while (chunk.status == QCborStreamReader::Ok) {
+        result += chunk.data;
+        chunk = reader.readString();
+    }
+    return result;
+}
+
+qint64 MqttClient::readCborInteger(QCborStreamReader& reader) {
+    // JSON 응답과 마찬가지로 숫자가 문자열/실수로 와도 허용
+    if (reader.isString()) {
+        return readCborString(reader).toLongLong();
+    }
+    
+    qint64 value = 0;
+    if (reader.isInteger()) {
+        value = reader.toInteger();
+    } else if (reader.isDouble()) {
+        value = static_cast<qint64>(reader.toDouble());
+    } else if (reader.isFloat()) {
+        value = static_cast<qint64>(reader.toFloat());
+    }
+    reader.next();
+    return value;
+}
+
+QByteArray MqttClient::inflate(const QByteArray& data) {
+#ifdef VIDEO_CLIENT_HAS_ZLIB
+    // qUncompress는 출력 크기 제한이 없으므로 zlib으로 직접 풀며 MAX_INFLATED_BYTES에서 중단
+    z_stream stream = {};
+    if (inflateInit(&stream) != Z_OK) {
+        return QByteArray();
+    }
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.constData()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    
+    QByteArray output;
+    int result = Z_OK;
+    while (result == Z_OK) {
+        if (output.size() >= MAX_INFLATED_BYTES) {
+            qWarning() << "Compressed response exceeds" << MAX_INFLATED_BYTES << "bytes, rejected";
+            inflateEnd(&stream);
+            return QByteArray();
+        }
+        qsizetype offset = output.size();
+        output.resize(qMin<qsizetype>(offset + INFLATE_CHUNK_BYTES, MAX_INFLATED_BYTES));
+        stream.next_out = reinterpret_cast<Bytef*>(output.data() + offset);
+        stream.avail_out = static_cast<uInt>(output.size() - offset);
+        result = ::inflate(&stream, Z_NO_FLUSH);
+        output.resize(output.size() - stream.avail_out);
+        if (result == Z_BUF_ERROR && stream.avail_in > 0) {
+            result = Z_OK;      // 출력 버퍼만 부족했던 경우
+        }
+    }
+    inflateEnd(&stream);
+    return result == Z_STREAM_END ? output : QByteArray();
+#else
+    Q_UNUSED(data);
+    qWarning() << "Compressed response received but zlib is not available";
+    return QByteArray();
+#endif
+}
+
+void MqttClient::recordParseTime(const QString& format, qint64 bytes, int count, qint64 nsecs) {
+    ParseStats& stats = m_parseStats[format];
+    stats.messages += 1;
+    stats.bytes += bytes;
+    stats.nsecs += nsecs;
+    
+    qDebug() << "Parsed" << count << "videos from" << bytes << "bytes (" << format << ") in"
+             << QString::number(nsecs / 1000000.0, 'f', 2) << "ms, average"
+             << QString::number(stats.nsecs / 1000000.0 / stats.messages, 'f', 2) << "ms over"
+             << stats.messages << "responses";
+}
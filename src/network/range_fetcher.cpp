@@ -0,0 +1,215 @@
+#include "../../include/network/range_fetcher.h"
+#include <QNetworkRequest>
+#include <QRegularExpression>
+#include <QDebug>
+#include <QPointer>
+#include <memory>
+
+RangeFetcher::RangeFetcher(QNetworkAccessManager* manager,
+                           BandwidthGovernor* governor,
+                           const QString& url,
+                           qint64 startMs,
+                           qint64 endMs,
+                           const QString& outputPath,
+                           QObject *parent)
+    : QObject(parent)
+    , m_manager(manager)
+    , m_governor(governor)
+    , m_url(url)
+    , m_startMs(startMs)
+    , m_endMs(endMs)
+    , m_outputPath(outputPath)
+{
+}
+
+void RangeFetcher::start() {
+    probe(0);
+}
+
+void RangeFetcher::requestRange(qint64 offset, qint64 length, RangeHandler handler) {
+    QNetworkRequest request{QUrl(m_url)};
+    request.setRawHeader("User-Agent", "Factory Video Client");
+    request.setRawHeader("Range", QString("bytes=%1-%2").arg(offset).arg(offset + length - 1).toLatin1());
+    
+    QNetworkReply* reply = m_manager->get(request);
+    m_activeReplies.append(reply);
+    
+    // 대역폭 제한기를 거쳐 본문 수신
+    auto body = std::make_shared<QByteArray>();
+    QPointer<RangeFetcher> self(this);
+    m_governor->attach(reply, BandwidthGovernor::Interactive,
+        [body](const QByteArray& data) {
+            body->append(data);
+        },
+        [this, self, reply, handler, body]() {
+            reply->deleteLater();
+            if (!self) return;
+            m_activeReplies.removeOne(reply);
+            if (m_finished) return;
+            
+            if (reply->error() != QNetworkReply::NoError) {
+                finish(false, reply->errorString());
+                return;
+            }
+            
+            // 206이 아니면 서버가 Range를 무시하고 전체 파일을 보낸 것
+            int status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+            if (status != 206) {
+                finish(false, QString("Range not supported (HTTP %1)").arg(status));
+                return;
+            }
+            
+            // Content-Range: bytes 0-65535/123456789
+            static const QRegularExpression totalPattern("/(\\d+)$");
+            QRegularExpressionMatch match = totalPattern.match(QString::fromLatin1(reply->rawHeader("Content-Range")));
+            if (match.hasMatch()) {
+                m_fileSize = match.captured(1).toLongLong();
+            }
+            
+            m_bytesReceived += body->size();
+            handler(*body);
+        });
+    
+    // 응답 본문이 요청보다 크면 (Range 무시) 즉시 중단
+    connect(reply, &QNetworkReply::metaDataChanged, this, [reply]() {
+        int status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+        if (status == 200) {
+            reply->abort();
+        }
+    });
+}
+
+void RangeFetcher::probe(qint64 offset) {
+    if (++m_probeCount > MAX_PROBES) {
+        finish(false, "moov not found");
+        return;
+    }
+    
+    qint64 length = PROBE_SIZE;
+    if (m_fileSize > 0) {
+        length = qMin(length, m_fileSize - offset);
+    }
+    if (length <= 0) {
+        finish(false, "moov not found");
+        return;
+    }
+    
+    requestRange(offset, length, [this, offset](const QByteArray& data) {
+        Mp4TopLevelScan scan = Mp4Index::scanTopLevel(data, offset);
+        if (!scan.ftyp.isEmpty()) {
+            m_ftyp = scan.ftyp;
+        }
+        if (scan.fragmented) {
+            finish(false, "Fragmented MP4 is not supported");
+            return;
+        }
+        
+        if (scan.moovOffset >= 0) {
+            qint64 moovSize = scan.moovSize;
+            if (moovSize < 0 && m_fileSize > 0) {
+                moovSize = m_fileSize - scan.moovOffset;
+            }
+            if (moovSize <= 0) {
+                finish(false, "Invalid moov size");
+                return;
+            }
+            
+            // 이미 받은 데이터에 moov 전체가 있으면 바로 사용
+            qint64 local = scan.moovOffset - offset;
+            if (local + moovSize <= data.size()) {
+                onMoovReceived(data.mid(local, moovSize));
+            } else {
+                requestRange(scan.moovOffset, moovSize, [this](const QByteArray& moov) {
+                    onMoovReceived(moov);
+                });
+            }
+            return;
+        }
+        
+        if (scan.nextOffset < 0 || (m_fileSize > 0 && scan.nextOffset >= m_fileSize)) {
+            finish(false, "moov not found");
+            return;
+        }
+        
+        // moov가 mdat 뒤에 있는 경우: 다음 박스 헤더 위치로 건너뜀
+        probe(scan.nextOffset);
+    });
+}
+
+void RangeFetcher::onMoovReceived(const QByteArray& moov) {
+    if (!m_index.parse(moov, m_fileSize)) {
+        finish(false, m_index.errorString());
+        return;
+    }
+    if (!m_index.selectRange(m_startMs, m_endMs)) {
+        finish(false, m_index.errorString());
+        return;
+    }
+    
+    m_pendingRanges = m_index.requiredRanges(RANGE_MERGE_GAP);
+    m_rangeBytesTotal = 0;
+    for (const Mp4ByteRange& range : m_pendingRanges) {
+        m_rangeBytesTotal += range.length;
+    }
+    
+    qDebug() << "Range fetch" << m_url << m_startMs << "-" << m_endMs << "ms:"
+             << m_pendingRanges.size() << "ranges," << m_rangeBytesTotal << "bytes of" << m_fileSize
+             << "(keyframe at" << m_index.selectedStartMs() << "ms)";
+    
+    if (m_pendingRanges.isEmpty()) {
+        finish(false, "No samples in range");
+        return;
+    }
+    fetchPendingRanges();
+}
+
+void RangeFetcher::fetchPendingRanges() {
+    while (!m_pendingRanges.isEmpty() && m_activeReplies.size() < MAX_PARALLEL_RANGES) {
+        Mp4ByteRange range = m_pendingRanges.takeFirst();
+        requestRange(range.offset, range.length, [this, range](const QByteArray& data) {
+            if (data.size() < range.length) {
+                finish(false, "Short range response");
+                return;
+            }
+            m_rangeData.insert(range.offset, data);
+            
+            qint64 received = 0;
+            for (const QByteArray& chunk : std::as_const(m_rangeData)) {
+                received += chunk.size();
+            }
+            emit progress(received, m_rangeBytesTotal);
+            
+            if (m_pendingRanges.isEmpty() && m_activeReplies.isEmpty()) {
+                writeOutput();
+            } else {
+                fetchPendingRanges();
+            }
+        });
+    }
+}
+
+void RangeFetcher::writeOutput() {
+    if (!m_index.writeClip(m_outputPath, m_rangeData, m_ftyp)) {
+        finish(false, "Failed to write clip");
+        return;
+    }
+    
+    qDebug() << "Range fetch complete:" << m_outputPath
+             << "transferred" << m_bytesReceived << "bytes of" << m_fileSize;
+    finish(true, "");
+}
+
+void RangeFetcher::finish(bool success, const QString& error) {
+    if (m_finished) return;
+    m_finished = true;
+    
+    // 남은 요청 정리 (abort 중 목록이 바뀌므로 복사본으로 순회)
+    const QList<QNetworkReply*> replies = m_activeReplies;
+    m_activeReplies.clear();
+    for (QNetworkReply* reply : replies) {
+        reply->abort();
+    }
+    m_rangeData.clear();
+    
+    emit finished(success, success ? m_outputPath : QString(), error);
+}
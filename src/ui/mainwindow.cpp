@@ -2,18 +2,37 @@
 #include <QApplication>
 #include <QDateTime>
 #include <QMessageBox>
+#include <QTimer>
+#include <QMenu>
+#include <QDialog>
+#include <QDialogButtonBox>
+#include <QFormLayout>
+#include <QSpinBox>
+#include <QThreadPool>
+#include <algorithm>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , m_centralWidget(nullptr)
     , m_videoClient(new VideoClient(this))
+    , m_playerPool(new VideoPlayerPool(VideoPlayerPool::configuredPoolSize(), this))
+    , m_playerGovernor(new PlayerGovernor(PlayerGovernor::configuredMaxDecoding(), this))
 {
+    m_startupTimer.start();
+    
     setupUI();
     setupConnections();
     initializeFilters();
     
     setWindowTitle("Factory Video Client");
     resize(DEFAULT_WINDOW_WIDTH, DEFAULT_WINDOW_HEIGHT);
+    
+    // 이전 목록을 먼저 보여주고, 브로커 응답이 오면 백그라운드에서 갱신
+    loadCachedVideoList();
+    QTimer::singleShot(0, this, &MainWindow::onRefreshClicked);
+    
+    // 첫 재생 지연을 줄이기 위해 플레이어를 미리 생성
+    m_playerPool->warmUp();
 }
 
 MainWindow::~MainWindow() = default;
@@ -81,6 +100,7 @@ void MainWindow::setupVideoListUI() {
     m_videoList = new QListWidget;
     m_videoList->setToolTip("비디오 목록 - 더블클릭하면 새 창에서 재생됩니다");
     m_videoList->setAlternatingRowColors(true);
+    m_videoList->setContextMenuPolicy(Qt::CustomContextMenu);
     
     m_bottomLayout->addWidget(m_videoList);
     m_mainLayout->addLayout(m_bottomLayout);
@@ -95,9 +115,13 @@ void MainWindow::setupStatusUI() {
     m_statusLabel = new QLabel("Ready");
     m_statusLabel->setStyleSheet("QLabel { color: #666; font-size: 12px; }");
     
+    m_resourceLabel = new QLabel;
+    m_resourceLabel->setStyleSheet("QLabel { color: #666; font-size: 12px; }");
+    
     statusLayout->addWidget(m_progressBar);
     statusLayout->addWidget(m_statusLabel);
     statusLayout->addStretch();
+    statusLayout->addWidget(m_resourceLabel);
     
     m_mainLayout->addLayout(statusLayout);
 }
@@ -109,9 +133,14 @@ void MainWindow::setupConnections() {
     // 비디오 목록 연결
     connect(m_videoList, &QListWidget::itemSelectionChanged, this, &MainWindow::onVideoSelected);
     connect(m_videoList, &QListWidget::itemDoubleClicked, this, &MainWindow::onVideoDoubleClicked);
+    connect(m_videoList, &QListWidget::customContextMenuRequested, this, &MainWindow::onVideoContextMenu);
     
     // Enter 키로도 검색 가능
     connect(m_errorIdEdit, &QLineEdit::returnPressed, this, &MainWindow::onRefreshClicked);
+    
+    // 플레이어 창 닫힘 (풀 반환)
+    connect(m_playerPool, &VideoPlayerPool::playerReleased, this, &MainWindow::onVideoPlayerClosed);
+    connect(m_playerGovernor, &PlayerGovernor::statsUpdated, this, &MainWindow::onResourceStatsUpdated);
 }
 
 void MainWindow::initializeFilters() {
@@ -133,9 +162,13 @@ void MainWindow::onRefreshClicked() {
         return;
     }
     
-    // UI 상태 업데이트
-    m_statusLabel->setText("Querying videos...");
-    m_videoList->clear();
+    // UI 상태 업데이트 (캐시된 목록은 응답이 올 때까지 유지)
+    if (m_listIsStale) {
+        m_statusLabel->setText(m_statusLabel->text() + " - refreshing...");
+    } else {
+        m_statusLabel->setText("Querying videos...");
+        m_videoList->clear();
+    }
     m_refreshBtn->setEnabled(false);
     
     // 검색 매개변수 준비
@@ -148,18 +181,79 @@ void MainWindow::onRefreshClicked() {
     qint64 startTime = m_startTimeEdit->dateTime().toMSecsSinceEpoch();
     qint64 endTime = m_endTimeEdit->dateTime().toMSecsSinceEpoch();
     
-    // 비디오 목록 요청
-    m_videoClient->queryVideos(device, errorId, startTime, endTime, MAX_VIDEO_RESULTS,
-        [this](const QList<VideoInfo>& videos) {
-            // 성공 콜백
-            populateVideoList(videos);
-            m_statusLabel->setText(QString("Found %1 videos").arg(videos.size()));
+    // 시작 화면용 스냅샷은 기본 조건(전체 디바이스, 에러 ID 없음, 기본 기간) 결과만 저장
+    bool defaultFilter = device.isEmpty() && errorId.isEmpty()
+        && m_startTimeEdit->dateTime().daysTo(m_endTimeEdit->dateTime()) == DEFAULT_SEARCH_DAYS;
+    
+    // 비디오 목록 요청 (라인별 브로커의 응답이 올 때마다 병합 결과로 갱신)
+    int generation = ++m_queryGeneration;
+    m_videoClient->queryVideosStreaming(device, errorId, startTime, endTime, MAX_VIDEO_RESULTS,
+        [this, generation, defaultFilter](const QList<VideoInfo>& videos, const VideoQueryProgress& progress) {
+            if (generation != m_queryGeneration) return;
+            
+            // 응답한 브로커가 없으면 캐시된 목록 유지
+            bool firstFreshList = m_listIsStale;
+            if (progress.answered > 0 || !m_listIsStale) {
+                populateVideoList(videos);
+            }
+            
+            QString status = QString("Found %1 videos").arg(videos.size());
+            if (progress.total > 1) {
+                status += QString(" (%1/%2 lines answered)").arg(progress.answered).arg(progress.total);
+            }
+            if (progress.timedOut > 0) {
+                status += QString(" - %1 timed out").arg(progress.timedOut);
+            }
+            if (!progress.complete) {
+                status += " - waiting...";
+            }
+            m_statusLabel->setText(status);
+            
+            if (firstFreshList && !m_listIsStale) {
+                qDebug() << "Startup to fresh list:" << m_startupTimer.elapsed() << "ms";
+            }
+            
+            if (!progress.complete) return;
             m_refreshBtn->setEnabled(true);
+            
+            // 다음 실행을 위해 스냅샷 저장 (빈 결과나 좁힌 검색은 이전 스냅샷 유지)
+            if (defaultFilter && !videos.isEmpty()) {
+                VideoListCache cache = m_listCache;
+                QThreadPool::globalInstance()->start([cache, videos]() {
+                    cache.save(videos);
+                });
+            }
         });
 }
 
-void MainWindow::populateVideoList(const QList<VideoInfo>& videos) {
+void MainWindow::loadCachedVideoList() {
+    QList<VideoInfo> videos;
+    qint64 savedAt = 0;
+    if (!m_listCache.load(videos, &savedAt) || videos.isEmpty()) {
+        return;
+    }
+    
+    populateVideoList(videos, true);
+    
+    qint64 elapsed = m_startupTimer.elapsed();
+    qDebug() << "Startup to cached list:" << elapsed << "ms," << videos.size() << "videos";
+    
+    m_statusLabel->setText(QString("Showing %1 cached videos from %2 (stale, %3 ms)")
+                         .arg(videos.size())
+                         .arg(QDateTime::fromMSecsSinceEpoch(savedAt).toString("yyyy-MM-dd hh:mm"))
+                         .arg(elapsed));
+}
+
+void MainWindow::populateVideoList(const QList<VideoInfo>& videos, bool stale) {
+    // 대량 결과에서도 한 번만 다시 그리도록 갱신 중지
+    m_videoList->setUpdatesEnabled(false);
+    
+    // 응답이 나눠 도착해 목록을 다시 채워도 선택 유지
+    QListWidgetItem* current = m_videoList->currentItem();
+    QString selectedUrl = current ? current->data(HttpUrlRole).toString() : QString();
+    
     m_videoList->clear();
+    m_listIsStale = stale;
     
     for (const auto& video : videos) {
         QString itemText = QString("[%1] %2 - %3 (%4)")
@@ -169,21 +263,30 @@ void MainWindow::populateVideoList(const QList<VideoInfo>& videos) {
             .arg(VideoClient::formatDuration(video.video_duration));
         
         QListWidgetItem* item = new QListWidgetItem(itemText);
-        item->setData(Qt::UserRole, video.http_url);
-        
-        // 디버그: HTTP URL 출력
-        qDebug() << "[DEBUG] Storing HTTP URL:" << video.http_url;
-        qDebug() << "[DEBUG] Video ID:" << video.video_id;
-        qDebug() << "[DEBUG] Device ID:" << video.device_id;
-        qDebug() << "[DEBUG] File Path:" << video.file_path;
+        item->setData(HttpUrlRole, video.http_url);
+        item->setData(ErrorLogIdRole, video.error_log_id);
+        item->setData(CreatedTimeRole, video.video_created_time);
+        item->setData(DurationRole, video.video_duration);
         
         item->setToolTip(QString("비디오 URL: %1\n파일 크기: %2\n재생 시간: %3")
                         .arg(video.http_url)
                         .arg(VideoClient::formatFileSize(video.file_size))
                         .arg(VideoClient::formatDuration(video.video_duration)));
         
+        // 캐시된 항목은 회색 기울임체로 구분
+        if (stale) {
+            QFont font = item->font();
+            font.setItalic(true);
+            item->setFont(font);
+            item->setForeground(Qt::gray);
+        }
+        
         m_videoList->addItem(item);
+        if (!selectedUrl.isEmpty() && video.http_url == selectedUrl) {
+            m_videoList->setCurrentItem(item);
+        }
     }
+    m_videoList->setUpdatesEnabled(true);
 }
 
 void MainWindow::onVideoSelected() {
@@ -196,7 +299,8 @@ void MainWindow::onVideoDoubleClicked() {
         return;
     }
     
-    QString httpUrl = currentItem->data(Qt::UserRole).toString();
+    QString httpUrl = currentItem->data(HttpUrlRole).toString();
+    QString errorLogId = currentItem->data(ErrorLogIdRole).toString();
     
     // 디버그: 더블클릭시 HTTP URL 출력
     qDebug() << "[DEBUG] Double-clicked video HTTP URL:" << httpUrl;
@@ -212,21 +316,12 @@ void MainWindow::onVideoDoubleClicked() {
     m_statusLabel->setText("Downloading video...");
     
     m_videoClient->downloadVideo(httpUrl,
-        [this, httpUrl](bool success, const QString& localPath) {
+        [this, httpUrl, errorLogId](bool success, const QString& localPath) {
             // 다운로드 진행률 숨김
             m_progressBar->setVisible(false);
             
             if (success) {
-                // 비디오 플레이어 생성 및 표시
-                VideoPlayer* player = new VideoPlayer(localPath);
-                
-                // 창 닫힘 시그널 연결
-                connect(player, &VideoPlayer::destroyed, this, &MainWindow::onVideoPlayerClosed);
-                
-                player->show();
-                m_videoPlayers.append(player);
-                m_statusLabel->setText(QString("Video opened in new window (%1 players active)")
-                                     .arg(m_videoPlayers.size()));
+                openPlayer(httpUrl, errorLogId, localPath);
             } else {
                 m_statusLabel->setText("Download failed");
                 QMessageBox::critical(this, "Download Error", 
@@ -236,13 +331,163 @@ void MainWindow::onVideoDoubleClicked() {
         }, m_progressBar, m_statusLabel);
 }
 
-void MainWindow::onVideoPlayerClosed() {
-    // 닫힌 VideoPlayer를 리스트에서 제거
-    VideoPlayer* closedPlayer = qobject_cast<VideoPlayer*>(sender());
-    if (closedPlayer) {
-        m_videoPlayers.removeAll(closedPlayer);
-        m_statusLabel->setText(QString("Video player closed (%1 players active)")
-                             .arg(m_videoPlayers.size()));
+void MainWindow::openPlayer(const QString& httpUrl, const QString& errorLogId, const QString& localPath) {
+    // 현재 목록에서 같은 인시던트의 클립 수집
+    QList<PlaylistEntry> clips = collectIncidentClips(errorLogId);
+    
+    // 풀에서 플레이어를 꺼내 표시
+    VideoPlayer* player = m_playerPool->acquire();
+    bool opened = false;
+    
+    int startIndex = -1;
+    for (int i = 0; i < clips.size(); ++i) {
+        if (clips[i].httpUrl == httpUrl) {
+            clips[i].localPath = localPath;
+            startIndex = i;
+        }
+    }
+    
+    if (clips.size() > 1 && startIndex >= 0) {
+        // 나머지 클립은 플레이어가 재생 중에 미리 받아 둠
+        VideoClient* client = m_videoClient;
+        opened = player->openPlaylist(clips, startIndex,
+            [client](const QString& url, bool urgent, PlaylistFetchDone done) {
+                client->downloadVideo(url, done, nullptr, nullptr,
+                                      urgent ? BandwidthGovernor::Interactive : BandwidthGovernor::Background);
+            });
+    } else {
+        // 단일 클립도 내보내기 타임스탬프용 생성 시각 전달
+        qint64 createdTime = startIndex >= 0 ? clips[startIndex].createdTime : 0;
+        clips.clear();
+        opened = player->openVideo(localPath, createdTime);
+    }
+    
+    if (!opened) {
+        m_playerPool->release(player);
+        return;
+    }
+    
+    player->show();
+    player->raise();
+    m_playerGovernor->track(player);
+    m_statusLabel->setText(QString("Video opened in new window (%1 players active, %2 clips)")
+                         .arg(m_playerPool->activeCount())
+                         .arg(clips.isEmpty() ? 1 : clips.size()));
+}
+
+QList<PlaylistEntry> MainWindow::collectIncidentClips(const QString& errorLogId) const {
+    QList<PlaylistEntry> clips;
+    if (errorLogId.isEmpty()) {
+        return clips;
+    }
+    
+    for (int row = 0; row < m_videoList->count(); ++row) {
+        QListWidgetItem* item = m_videoList->item(row);
+        if (item->data(ErrorLogIdRole).toString() != errorLogId) continue;
+        
+        PlaylistEntry entry;
+        entry.httpUrl = item->data(HttpUrlRole).toString();
+        entry.createdTime = item->data(CreatedTimeRole).toLongLong();
+        entry.durationMs = item->data(DurationRole).toLongLong() * 1000;
+        clips.append(entry);
     }
+    
+    std::sort(clips.begin(), clips.end(), [](const PlaylistEntry& a, const PlaylistEntry& b) {
+        return a.createdTime < b.createdTime;
+    });
+    return clips;
+}
+
+void MainWindow::onVideoContextMenu(const QPoint& pos) {
+    if (!m_videoList->itemAt(pos)) return;
+    
+    QMenu menu(this);
+    menu.addAction("Play", this, &MainWindow::onVideoDoubleClicked);
+    menu.addAction("Fetch time range...", this, &MainWindow::onFetchRangeRequested);
+    menu.exec(m_videoList->viewport()->mapToGlobal(pos));
 }
 
+void MainWindow::onFetchRangeRequested() {
+    QListWidgetItem* currentItem = m_videoList->currentItem();
+    if (!currentItem) return;
+    
+    QString httpUrl = currentItem->data(HttpUrlRole).toString();
+    int durationSec = currentItem->data(DurationRole).toInt();
+    if (httpUrl.isEmpty()) return;
+    
+    // 구간 입력 대화상자 (초 단위)
+    QDialog dialog(this);
+    dialog.setWindowTitle("Fetch Time Range");
+    QFormLayout* form = new QFormLayout(&dialog);
+    
+    QSpinBox* startSpin = new QSpinBox;
+    QSpinBox* endSpin = new QSpinBox;
+    int maxSec = durationSec > 0 ? durationSec : 24 * 3600;
+    startSpin->setRange(0, maxSec);
+    endSpin->setRange(1, maxSec);
+    endSpin->setValue(qMin(maxSec, DEFAULT_RANGE_SECONDS));
+    startSpin->setSuffix(" s");
+    endSpin->setSuffix(" s");
+    
+    QDialogButtonBox* buttons = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel);
+    connect(buttons, &QDialogButtonBox::accepted, &dialog, &QDialog::accept);
+    connect(buttons, &QDialogButtonBox::rejected, &dialog, &QDialog::reject);
+    
+    form->addRow("From:", startSpin);
+    form->addRow("To:", endSpin);
+    form->addRow(buttons);
+    
+    if (dialog.exec() != QDialog::Accepted) return;
+    if (endSpin->value() <= startSpin->value()) {
+        QMessageBox::warning(this, "Invalid Range", "끝 시간은 시작 시간보다 커야 합니다.");
+        return;
+    }
+    
+    m_progressBar->setVisible(true);
+    
+    m_videoClient->fetchRange(httpUrl,
+        static_cast<qint64>(startSpin->value()) * 1000,
+        static_cast<qint64>(endSpin->value()) * 1000,
+        [this, httpUrl](bool success, const QString& localPath, qint64 startOffsetMs) {
+            m_progressBar->setVisible(false);
+            
+            if (!success) {
+                m_statusLabel->setText("Download failed");
+                QMessageBox::critical(this, "Download Error",
+                                    QString("비디오 구간 다운로드에 실패했습니다.\nURL: %1")
+                                    .arg(httpUrl));
+                return;
+            }
+            
+            // 키프레임부터 받은 구간 클립이든 전체 파일 대체든 요청한 시작 위치부터 재생
+            VideoPlayer* player = m_playerPool->acquire();
+            if (player->openVideo(localPath, 0, startOffsetMs)) {
+                player->show();
+                player->raise();
+                m_playerGovernor->track(player);
+            } else {
+                m_playerPool->release(player);
+            }
+        }, m_progressBar, m_statusLabel);
+}
+
+void MainWindow::onVideoPlayerClosed(VideoPlayer* player) {
+    m_playerGovernor->untrack(player);
+    m_statusLabel->setText(QString("Video player closed (%1 players active)")
+                         .arg(m_playerPool->activeCount()));
+}
+
+void MainWindow::onResourceStatsUpdated(const PlayerResourceStats& stats) {
+    QString text = QString("Players: %1 decoding / %2 open (max %3), %4 suspended")
+        .arg(stats.decodingPlayers)
+        .arg(stats.trackedPlayers)
+        .arg(m_playerGovernor->maxDecoding())
+        .arg(stats.suspendedPlayers);
+    if (stats.residentBytes >= 0) {
+        text += QString(" | Mem %1").arg(VideoClient::formatFileSize(stats.residentBytes));
+    }
+    if (stats.cpuPercent >= 0) {
+        text += QString(" | CPU %1%").arg(stats.cpuPercent, 0, 'f', 0);
+    }
+    m_resourceLabel->setText(text);
+}
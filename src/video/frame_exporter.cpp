@@ -0,0 +1,298 @@
+#include "../../include/video/frame_exporter.h"
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QImageWriter>
+#include <QPainter>
+#include <QUrl>
+#include <QDebug>
+#include <QtMath>
+
+FrameExporter::FrameExporter(QObject *parent)
+    : QObject(parent)
+    , m_player(new QMediaPlayer(this))
+    , m_sink(new QVideoSink(this))
+{
+    // 오디오 출력 없이 싱크로만 디코딩
+    m_player->setVideoSink(m_sink);
+    
+    m_frameTimeout.setSingleShot(true);
+    m_frameTimeout.setInterval(FRAME_TIMEOUT_MS);
+    
+    connect(m_player, &QMediaPlayer::mediaStatusChanged, this, &FrameExporter::onMediaStatusChanged);
+    connect(m_player, &QMediaPlayer::errorOccurred, this, [this]() {
+        if (!m_running) return;
+        qWarning() << "Frame export failed:" << m_videoPath << m_player->errorString();
+        cancel();
+    });
+    connect(m_sink, &QVideoSink::videoFrameChanged, this, &FrameExporter::onVideoFrame);
+    connect(&m_frameTimeout, &QTimer::timeout, this, [this]() {
+        // 정확한 위치의 프레임이 오지 않으면 마지막으로 받은 프레임 사용
+        if (!m_seeking) return;
+        if (m_lastFrame.isValid()) {
+            acceptFrame(m_lastFrame);
+        } else {
+            qWarning() << "No frame at" << m_positions[m_next] << "ms, skipped";
+            int index = m_next++;
+            m_seeking = false;
+            seekNext();
+            onFrameEncoded(index, false, QImage());
+        }
+    });
+}
+
+FrameExporter::~FrameExporter() {
+    // 작업 스레드가 this를 참조하므로 모두 끝날 때까지 대기
+    m_cancelled = true;
+    m_pool.waitForDone();
+}
+
+bool FrameExporter::start(const QString& videoPath, const FrameExportOptions& options) {
+    if (m_running) return false;
+    if (!QDir().mkpath(options.outputDir)) {
+        qWarning() << "Cannot create export directory:" << options.outputDir;
+        return false;
+    }
+    
+    m_videoPath = videoPath;
+    m_options = options;
+    m_positions.clear();
+    m_thumbnails.clear();
+    m_next = 0;
+    m_encoded = 0;
+    m_saved = 0;
+    m_lastFrame = QVideoFrame();
+    m_seeking = false;
+    m_cancelled = false;
+    m_running = true;
+    m_timer.start();
+    
+    m_player->setSource(QUrl::fromLocalFile(videoPath));
+    return true;
+}
+
+void FrameExporter::cancel() {
+    if (!m_running) return;
+    m_cancelled = true;
+    m_running = false;
+    m_seeking = false;
+    m_frameTimeout.stop();
+    m_player->stop();
+    m_player->setSource(QUrl());
+    emit finished(false, m_saved, QString());
+}
+
+void FrameExporter::onMediaStatusChanged(QMediaPlayer::MediaStatus status) {
+    if (!m_running) return;
+    
+    if (status == QMediaPlayer::InvalidMedia) {
+        qWarning() << "Frame export: invalid media" << m_videoPath;
+        cancel();
+        return;
+    }
+    if (status != QMediaPlayer::LoadedMedia || !m_positions.isEmpty()) return;
+    
+    // 추출 위치 계산
+    qint64 duration = m_player->duration();
+    if (m_options.mode == FrameExportOptions::Interval) {
+        qint64 step = qMax(1, m_options.intervalSeconds) * 1000LL;
+        for (qint64 t = 0; t < duration && m_positions.size() < MAX_FRAMES; t += step) {
+            m_positions.append(t);
+        }
+    } else {
+        int count = qBound(1, m_options.burstCount, MAX_FRAMES);
+        qint64 first = m_options.burstCenterMs - qint64(count / 2) * m_options.burstSpacingMs;
+        for (int i = 0; i < count; ++i) {
+            qint64 t = first + qint64(i) * m_options.burstSpacingMs;
+            if (t >= 0 && t < duration) {
+                m_positions.append(t);
+            }
+        }
+    }
+    
+    if (m_positions.isEmpty()) {
+        qWarning() << "Frame export: no frames in range";
+        cancel();
+        return;
+    }
+    
+    m_thumbnails.resize(m_positions.size());
+    emit progress(0, m_positions.size());
+    
+    m_player->pause();
+    seekNext();
+}
+
+void FrameExporter::seekNext() {
+    if (!m_running) return;
+    if (m_next >= m_positions.size()) {
+        // 탐색 종료 - 남은 인코딩 작업이 끝나면 finishExport
+        m_seeking = false;
+        m_player->stop();
+        return;
+    }
+    // 인코딩이 밀리면 디코더 버퍼를 붙잡지 않도록 잠시 대기 (onFrameEncoded에서 재개)
+    if (m_next - m_encoded >= m_pool.maxThreadCount() * MAX_IN_FLIGHT_PER_THREAD) {
+        return;
+    }
+    
+    m_seeking = true;
+    m_lastFrame = QVideoFrame();
+    m_player->setPosition(m_positions[m_next]);
+    m_frameTimeout.start();
+}
+
+void FrameExporter::onVideoFrame(const QVideoFrame& frame) {
+    if (!m_seeking || !frame.isValid()) return;
+    m_lastFrame = frame;
+    
+    // 탐색 이전 위치의 프레임은 무시 (타임스탬프가 없으면 그대로 사용)
+    qint64 target = m_positions[m_next];
+    if (frame.startTime() >= 0 && qAbs(frame.startTime() / 1000 - target) > SEEK_TOLERANCE_MS) {
+        return;
+    }
+    acceptFrame(frame);
+}
+
+void FrameExporter::acceptFrame(const QVideoFrame& frame) {
+    m_frameTimeout.stop();
+    m_seeking = false;
+    
+    int index = m_next++;
+    QString path = framePath(index, m_positions[index]);
+    QByteArray format = m_options.format.toLatin1();
+    int quality = m_options.format == "png" ? -1 : m_options.jpegQuality;
+    bool wantThumbnail = m_options.contactSheet;
+    
+    // 변환(YUV→RGB)과 인코딩은 스레드 풀에서 처리
+    m_pool.start([this, frame, index, path, format, quality, wantThumbnail]() {
+        if (m_cancelled) return;
+        
+        QImage image = frame.toImage();
+        bool ok = false;
+        QImage thumbnail;
+        if (!image.isNull()) {
+            QImageWriter writer(path, format);
+            writer.setQuality(quality);
+            ok = writer.write(image);
+            if (!ok) {
+                qWarning() << "Frame export: cannot write" << path << writer.errorString();
+            }
+            if (wantThumbnail) {
+                thumbnail = image.scaledToWidth(THUMBNAIL_WIDTH, Qt::SmoothTransformation);
+            }
+        }
+        
+        QMetaObject::invokeMethod(this, [this, index, ok, thumbnail]() {
+            onFrameEncoded(index, ok, thumbnail);
+        }, Qt::QueuedConnection);
+    });
+    
+    seekNext();
+}
+
+void FrameExporter::onFrameEncoded(int index, bool ok, const QImage& thumbnail) {
+    if (!m_running) return;
+    
+    m_thumbnails[index] = thumbnail;
+    if (ok) ++m_saved;
+    ++m_encoded;
+    emit progress(m_encoded, m_positions.size());
+    
+    if (m_encoded == m_positions.size()) {
+        finishExport();
+    } else if (!m_seeking) {
+        seekNext();
+    }
+}
+
+void FrameExporter::finishExport() {
+    if (!m_options.contactSheet || m_saved == 0) {
+        m_running = false;
+        qDebug() << "Exported" << m_saved << "frames in" << m_timer.elapsed() << "ms";
+        emit finished(m_saved > 0, m_saved, QString());
+        return;
+    }
+    
+    // 빈 프레임은 제외하고 라벨과 함께 시트 구성 (워커에서 처리)
+    QVector<QImage> thumbnails;
+    QStringList labels;
+    for (int i = 0; i < m_thumbnails.size(); ++i) {
+        if (m_thumbnails[i].isNull()) continue;
+        thumbnails.append(m_thumbnails[i]);
+        labels.append(frameLabel(m_positions[i]));
+    }
+    m_thumbnails.clear();
+    
+    QString sheetPath = QDir(m_options.outputDir).filePath(
+        QString("%1_sheet.%2").arg(QFileInfo(m_videoPath).completeBaseName(), m_options.format));
+    QByteArray format = m_options.format.toLatin1();
+    int columns = qMax(1, m_options.sheetColumns);
+    
+    m_pool.start([this, thumbnails, labels, sheetPath, format, columns]() {
+        QImage sheet = composeSheet(thumbnails, labels, columns);
+        bool ok = !m_cancelled && QImageWriter(sheetPath, format).write(sheet);
+        
+        QMetaObject::invokeMethod(this, [this, ok, sheetPath]() {
+            if (!m_running) return;
+            m_running = false;
+            qDebug() << "Exported" << m_saved << "frames and contact sheet in" << m_timer.elapsed() << "ms";
+            emit finished(true, m_saved, ok ? sheetPath : QString());
+        }, Qt::QueuedConnection);
+    });
+}
+
+QImage FrameExporter::composeSheet(const QVector<QImage>& thumbnails, const QStringList& labels, int columns) {
+    int cellWidth = 0;
+    int cellHeight = 0;
+    for (const QImage& thumbnail : thumbnails) {
+        cellWidth = qMax(cellWidth, thumbnail.width());
+        cellHeight = qMax(cellHeight, thumbnail.height());
+    }
+    cellHeight += SHEET_LABEL_HEIGHT;
+    
+    columns = qMin(columns, int(thumbnails.size()));
+    int rows = (int(thumbnails.size()) + columns - 1) / columns;
+    QImage sheet(columns * (cellWidth + SHEET_SPACING) + SHEET_SPACING,
+                 rows * (cellHeight + SHEET_SPACING) + SHEET_SPACING,
+                 QImage::Format_RGB32);
+    sheet.fill(Qt::black);
+    
+    QPainter painter(&sheet);
+    painter.setPen(Qt::white);
+    QFont font = painter.font();
+    font.setPixelSize(SHEET_LABEL_HEIGHT - 6);
+    painter.setFont(font);
+    
+    for (int i = 0; i < thumbnails.size(); ++i) {
+        int x = SHEET_SPACING + (i % columns) * (cellWidth + SHEET_SPACING);
+        int y = SHEET_SPACING + (i / columns) * (cellHeight + SHEET_SPACING);
+        painter.drawImage(x, y, thumbnails[i]);
+        painter.drawText(QRect(x, y + cellHeight - SHEET_LABEL_HEIGHT, cellWidth, SHEET_LABEL_HEIGHT),
+                         Qt::AlignCenter, labels[i]);
+    }
+    painter.end();
+    return sheet;
+}
+
+QString FrameExporter::frameLabel(qint64 positionMs) const {
+    if (m_options.createdTime > 0) {
+        return QDateTime::fromMSecsSinceEpoch(m_options.createdTime + positionMs)
+            .toString("yyyy-MM-dd hh:mm:ss.zzz");
+    }
+    
+    qint64 seconds = positionMs / 1000;
+    return QString("%1:%2.%3")
+        .arg(seconds / 60, 2, 10, QChar('0'))
+        .arg(seconds % 60, 2, 10, QChar('0'))
+        .arg(positionMs % 1000, 3, 10, QChar('0'));
+}
+
+QString FrameExporter::framePath(int index, qint64 positionMs) const {
+    return QDir(m_options.outputDir).filePath(
+        QString("%1_%2_%3ms.%4")
+            .arg(QFileInfo(m_videoPath).completeBaseName())
+            .arg(index, 4, 10, QChar('0'))
+            .arg(positionMs)
+            .arg(m_options.format));
+}
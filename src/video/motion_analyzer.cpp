@@ -0,0 +1,286 @@
+#include "../../include/video/motion_analyzer.h"
+#include "../../include/video/motion_kernels.h"
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+#include <QSaveFile>
+#include <QUrl>
+#include <QDebug>
+#include <utility>
+
+// === MotionAnalyzer ===
+
+MotionAnalyzer::MotionAnalyzer(QObject *parent)
+    : QObject(parent)
+    , m_grid(GRID_WIDTH * GRID_HEIGHT)
+    , m_prevGrid(GRID_WIDTH * GRID_HEIGHT)
+{
+}
+
+bool MotionAnalyzer::downscale(const QVideoFrame& input) {
+    QVideoFrame frame(input);
+    if (!frame.isValid() || !frame.map(QVideoFrame::ReadOnly)) {
+        return false;
+    }
+    
+    // 평면 YUV 형식은 첫 번째 평면이 루마이므로 복사 없이 바로 축소
+    bool done = false;
+    switch (frame.pixelFormat()) {
+    case QVideoFrameFormat::Format_NV12:
+    case QVideoFrameFormat::Format_NV21:
+    case QVideoFrameFormat::Format_YUV420P:
+    case QVideoFrameFormat::Format_YUV422P:
+    case QVideoFrameFormat::Format_YV12:
+    case QVideoFrameFormat::Format_IMC1:
+    case QVideoFrameFormat::Format_IMC2:
+    case QVideoFrameFormat::Format_IMC3:
+    case QVideoFrameFormat::Format_IMC4:
+    case QVideoFrameFormat::Format_Y8:
+        MotionKernels::downscaleLuma(frame.bits(0), frame.width(), frame.height(), frame.bytesPerLine(0),
+                                     m_grid.data(), GRID_WIDTH, GRID_HEIGHT, ROW_STEP);
+        done = true;
+        break;
+    default:
+        break;
+    }
+    frame.unmap();
+    
+    if (!done) {
+        // 루마 평면이 없는 형식(RGB, 패킹 YUV 등)은 그레이스케일 이미지로 변환 (느린 경로)
+        QImage image = input.toImage().convertToFormat(QImage::Format_Grayscale8);
+        if (image.isNull()) {
+            return false;
+        }
+        MotionKernels::downscaleLuma(image.constBits(), image.width(), image.height(), image.bytesPerLine(),
+                                     m_grid.data(), GRID_WIDTH, GRID_HEIGHT, ROW_STEP);
+    }
+    return true;
+}
+
+void MotionAnalyzer::processFrame(const QVideoFrame& frame) {
+    --pendingFrames;
+    if (!downscale(frame)) return;
+    
+    // 타임스탬프가 없으면 이전 프레임 기준으로 추정
+    qint64 timeUs = frame.startTime();
+    if (timeUs < 0) {
+        timeUs = m_lastTimeUs < 0 ? 0 : m_lastTimeUs + DEFAULT_FRAME_US;
+    }
+    m_lastTimeUs = timeUs;
+    
+    // 타임스탬프가 큰 절대값에서 시작하는 클립도 있으므로 첫 프레임 기준 상대 시간 사용
+    if (m_firstTimeUs < 0) {
+        m_firstTimeUs = timeUs;
+    }
+    qint64 second64 = qMax<qint64>(0, timeUs - m_firstTimeUs) / 1000000;
+    
+    // 클립 길이(모르면 MAX_SECONDS)를 넘는 시간은 잘못된 타임스탬프로 보고 버림
+    qint64 duration = durationMs.load();
+    qint64 maxSeconds = duration > 0 ? duration / 1000 + 1 : MAX_SECONDS;
+    
+    if (m_hasPrev && second64 < maxSeconds) {
+        const int cells = GRID_WIDTH * GRID_HEIGHT;
+        float energy = static_cast<float>(MotionKernels::sumAbsDiff(m_grid.constData(), m_prevGrid.constData(), cells))
+                     / cells;
+        
+        int second = static_cast<int>(second64);
+        if (second >= m_sums.size()) {
+            m_sums.resize(second + 1);
+            m_counts.resize(second + 1);
+        }
+        m_sums[second] += energy;
+        m_counts[second] += 1;
+    }
+    
+    std::swap(m_grid, m_prevGrid);
+    m_hasPrev = true;
+    
+    if (++m_framesSinceUpdate >= UPDATE_INTERVAL_FRAMES) {
+        m_framesSinceUpdate = 0;
+        emit updated(energyPerSecond());
+    }
+}
+
+void MotionAnalyzer::flush() {
+    emit completed(energyPerSecond());
+}
+
+QVector<float> MotionAnalyzer::energyPerSecond() const {
+    QVector<float> energy(m_sums.size());
+    float last = 0;
+    for (int i = 0; i < m_sums.size(); ++i) {
+        // 프레임이 건너뛰어진 초는 직전 값 유지
+        if (m_counts[i] > 0) {
+            last = static_cast<float>(m_sums[i] / m_counts[i]);
+        }
+        energy[i] = last;
+    }
+    return energy;
+}
+
+// === MotionAnalysisJob ===
+
+QHash<QString, MotionAnalysisJob*> MotionAnalysisJob::s_jobs;
+QList<MotionAnalysisJob*> MotionAnalysisJob::s_pending;
+int MotionAnalysisJob::s_running = 0;
+
+MotionAnalysisJob::MotionAnalysisJob(const QString& videoPath, QObject *parent)
+    : QObject(parent)
+    , m_videoPath(videoPath)
+    , m_analyzer(new MotionAnalyzer)
+{
+    // 분석기는 워커 스레드에서 실행
+    m_analyzer->moveToThread(&m_thread);
+    connect(&m_thread, &QThread::finished, m_analyzer, &QObject::deleteLater);
+    
+    connect(m_analyzer, &MotionAnalyzer::updated, this, [this](const QVector<float>& energy) {
+        emit progress(m_videoPath, energy);
+    });
+    connect(m_analyzer, &MotionAnalyzer::completed, this, [this](const QVector<float>& energy) {
+        complete(energy, true);
+    });
+    
+    m_thread.start(QThread::LowPriority);
+}
+
+MotionAnalysisJob::~MotionAnalysisJob() {
+    // 싱크 콜백은 디코더 스레드에서 분석기를 직접 참조하므로 디코딩을 먼저 멈춘 뒤 스레드 종료
+    stopDecoding();
+    m_thread.quit();
+    m_thread.wait();
+}
+
+void MotionAnalysisJob::stopDecoding() {
+    if (m_sink) {
+        m_sink->disconnect();
+    }
+    if (m_player) {
+        m_player->stop();
+        m_player->setVideoSink(nullptr);
+    }
+}
+
+QString MotionAnalysisJob::cachePath(const QString& videoPath) {
+    return videoPath + ".motion";
+}
+
+MotionAnalysisJob* MotionAnalysisJob::enqueue(const QString& videoPath) {
+    if (videoPath.isEmpty() || QFile::exists(cachePath(videoPath))) {
+        return nullptr;
+    }
+    if (MotionAnalysisJob* existing = s_jobs.value(videoPath)) {
+        return existing;
+    }
+    
+    MotionAnalysisJob* job = new MotionAnalysisJob(videoPath, QCoreApplication::instance());
+    s_jobs.insert(videoPath, job);
+    s_pending.append(job);
+    startPending();
+    return job;
+}
+
+void MotionAnalysisJob::startPending() {
+    while (s_running < MAX_RUNNING_JOBS && !s_pending.isEmpty()) {
+        s_pending.takeFirst()->start();
+    }
+}
+
+void MotionAnalysisJob::start() {
+    ++s_running;
+    m_timer.start();
+    
+    // 오디오 출력 없이 비디오 싱크로만 디코딩
+    m_player = new QMediaPlayer(this);
+    m_sink = new QVideoSink(this);
+    m_player->setVideoSink(m_sink);
+    
+    // 초 인덱스 상한으로 쓰도록 클립 길이를 분석기에 전달
+    connect(m_player, &QMediaPlayer::durationChanged, this, [analyzer = m_analyzer](qint64 duration) {
+        analyzer->durationMs.store(duration);
+    });
+    
+    // 디코더 스레드에서 바로 워커로 전달 (GUI 스레드를 거치지 않음)
+    MotionAnalyzer* analyzer = m_analyzer;
+    connect(m_sink, &QVideoSink::videoFrameChanged, analyzer, [analyzer](const QVideoFrame& frame) {
+        // 분석이 밀리면 프레임을 건너뜀 (초 단위 평균이므로 영향 적음)
+        if (analyzer->pendingFrames.load() >= MAX_PENDING_FRAMES) return;
+        ++analyzer->pendingFrames;
+        QMetaObject::invokeMethod(analyzer, [analyzer, frame]() {
+            analyzer->processFrame(frame);
+        }, Qt::QueuedConnection);
+    }, Qt::DirectConnection);
+    
+    connect(m_player, &QMediaPlayer::mediaStatusChanged, this, [this](QMediaPlayer::MediaStatus status) {
+        if (status == QMediaPlayer::EndOfMedia) {
+            // 대기 중인 프레임이 처리된 뒤 결과 전달
+            QMetaObject::invokeMethod(m_analyzer, &MotionAnalyzer::flush, Qt::QueuedConnection);
+        } else if (status == QMediaPlayer::InvalidMedia) {
+            complete(QVector<float>(), false);
+        }
+    });
+    connect(m_player, &QMediaPlayer::errorOccurred, this, [this]() {
+        qWarning() << "Motion analysis failed:" << m_videoPath << m_player->errorString();
+        complete(QVector<float>(), false);
+    });
+    
+    m_player->setSource(QUrl::fromLocalFile(m_videoPath));
+    m_player->setPlaybackRate(ANALYSIS_PLAYBACK_RATE);
+    m_player->play();
+}
+
+void MotionAnalysisJob::complete(const QVector<float>& energy, bool save) {
+    if (m_completed) return;
+    m_completed = true;
+    
+    if (m_player) {
+        stopDecoding();
+        --s_running;
+    }
+    
+    if (save && !energy.isEmpty()) {
+        saveCached(m_videoPath, energy);
+        qDebug() << "Motion analysis of" << QFileInfo(m_videoPath).fileName() << ":"
+                 << energy.size() << "s of video in" << m_timer.elapsed() << "ms"
+                 << "(" << MotionKernels::activeKernelName() << ")";
+    }
+    
+    s_jobs.remove(m_videoPath);
+    emit finished(m_videoPath, energy);
+    deleteLater();
+    
+    startPending();
+}
+
+bool MotionAnalysisJob::loadCached(const QString& videoPath, QVector<float>& energy) {
+    QFile file(cachePath(videoPath));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_6_0);
+    quint32 magic = 0;
+    quint16 version = 0;
+    QVector<float> result;
+    in >> magic >> version >> result;
+    
+    if (magic != CACHE_MAGIC || version != CACHE_VERSION || in.status() != QDataStream::Ok) {
+        return false;
+    }
+    energy = result;
+    return true;
+}
+
+bool MotionAnalysisJob::saveCached(const QString& videoPath, const QVector<float>& energy) {
+    QSaveFile file(cachePath(videoPath));
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_6_0);
+    out << CACHE_MAGIC << CACHE_VERSION << energy;
+    return file.commit();
+}
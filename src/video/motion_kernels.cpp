@@ -0,0 +1,208 @@
+#include "../../include/video/motion_kernels.h"
+#include <cstdlib>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MOTION_KERNELS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(MOTION_KERNELS_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define MOTION_KERNELS_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MOTION_KERNELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+// === 스칼라 (기준 구현) ===
+
+quint64 sadScalar(const quint8* a, const quint8* b, int length) {
+    quint64 sum = 0;
+    for (int i = 0; i < length; ++i) {
+        sum += static_cast<quint64>(std::abs(static_cast<int>(a[i]) - static_cast<int>(b[i])));
+    }
+    return sum;
+}
+
+quint64 sumScalar(const quint8* data, int length) {
+    quint64 sum = 0;
+    for (int i = 0; i < length; ++i) {
+        sum += data[i];
+    }
+    return sum;
+}
+
+// === SSE2: psadbw로 16바이트씩 ===
+
+#ifdef MOTION_KERNELS_SSE2
+quint64 horizontalSum(__m128i acc) {
+    alignas(16) quint64 lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return lanes[0] + lanes[1];
+}
+
+quint64 sadSse2(const quint8* a, const quint8* b, int length) {
+    __m128i acc = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(va, vb));
+    }
+    return horizontalSum(acc) + sadScalar(a + i, b + i, length - i);
+}
+
+quint64 sumSse2(const quint8* data, int length) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(v, zero));
+    }
+    return horizontalSum(acc) + sumScalar(data + i, length - i);
+}
+#endif
+
+// === AVX2: 32바이트씩 (실행 시 CPU 확인 후 사용) ===
+
+#ifdef MOTION_KERNELS_AVX2
+__attribute__((target("avx2")))
+quint64 horizontalSum256(__m256i acc) {
+    alignas(32) quint64 lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+__attribute__((target("avx2")))
+quint64 sadAvx2(const quint8* a, const quint8* b, int length) {
+    __m256i acc = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(va, vb));
+    }
+    return horizontalSum256(acc) + sadSse2(a + i, b + i, length - i);
+}
+
+__attribute__((target("avx2")))
+quint64 sumAvx2(const quint8* data, int length) {
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i acc = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(v, zero));
+    }
+    return horizontalSum256(acc) + sumSse2(data + i, length - i);
+}
+
+bool cpuHasAvx2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+#endif
+
+// === NEON: vabd + 쌍별 누적 ===
+
+#ifdef MOTION_KERNELS_NEON
+quint64 horizontalSumNeon(uint32x4_t acc) {
+    return static_cast<quint64>(vgetq_lane_u32(acc, 0)) + vgetq_lane_u32(acc, 1)
+         + vgetq_lane_u32(acc, 2) + vgetq_lane_u32(acc, 3);
+}
+
+quint64 sadNeon(const quint8* a, const quint8* b, int length) {
+    uint32x4_t acc = vdupq_n_u32(0);
+    int i = 0;
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t diff = vabdq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+        acc = vpadalq_u16(acc, vpaddlq_u8(diff));
+    }
+    return horizontalSumNeon(acc) + sadScalar(a + i, b + i, length - i);
+}
+
+quint64 sumNeon(const quint8* data, int length) {
+    uint32x4_t acc = vdupq_n_u32(0);
+    int i = 0;
+    for (; i + 16 <= length; i += 16) {
+        acc = vpadalq_u16(acc, vpaddlq_u8(vld1q_u8(data + i)));
+    }
+    return horizontalSumNeon(acc) + sumScalar(data + i, length - i);
+}
+#endif
+
+// === 커널 선택 ===
+
+struct KernelTable {
+    quint64 (*sad)(const quint8*, const quint8*, int);
+    quint64 (*sum)(const quint8*, int);
+    const char* name;
+};
+
+KernelTable selectKernels() {
+#ifdef MOTION_KERNELS_AVX2
+    if (cpuHasAvx2()) {
+        return {sadAvx2, sumAvx2, "AVX2"};
+    }
+#endif
+#ifdef MOTION_KERNELS_SSE2
+    return {sadSse2, sumSse2, "SSE2"};
+#elif defined(MOTION_KERNELS_NEON)
+    return {sadNeon, sumNeon, "NEON"};
+#else
+    return {sadScalar, sumScalar, "scalar"};
+#endif
+}
+
+const KernelTable& kernels() {
+    static const KernelTable table = selectKernels();
+    return table;
+}
+
+} // namespace
+
+namespace MotionKernels {
+
+quint64 sumAbsDiff(const quint8* a, const quint8* b, int length) {
+    return kernels().sad(a, b, length);
+}
+
+quint64 sumBytes(const quint8* data, int length) {
+    return kernels().sum(data, length);
+}
+
+void downscaleLuma(const quint8* plane, int width, int height, int stride,
+                   quint8* grid, int gridWidth, int gridHeight, int rowStep) {
+    const int blockWidth = qMax(1, width / gridWidth);
+    const int blockHeight = qMax(1, height / gridHeight);
+    const int step = qMax(1, rowStep);
+    
+    for (int gy = 0; gy < gridHeight; ++gy) {
+        const int y0 = qMin(gy * blockHeight, height - 1);
+        const int y1 = qMin(y0 + blockHeight, height);
+        for (int gx = 0; gx < gridWidth; ++gx) {
+            const int x0 = qMin(gx * blockWidth, width - 1);
+            const int w = qMin(blockWidth, width - x0);
+            
+            // 블록의 각 행 합을 SIMD로 계산
+            quint64 sum = 0;
+            int samples = 0;
+            for (int y = y0; y < y1; y += step) {
+                sum += sumBytes(plane + static_cast<qint64>(y) * stride + x0, w);
+                samples += w;
+            }
+            grid[gy * gridWidth + gx] = static_cast<quint8>(samples ? sum / samples : 0);
+        }
+    }
+}
+
+const char* activeKernelName() {
+    return kernels().name;
+}
+
+} // namespace MotionKernels
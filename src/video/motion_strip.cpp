@@ -0,0 +1,89 @@
+#include "../../include/video/motion_strip.h"
+#include <QPainter>
+#include <QPaintEvent>
+#include <QtMath>
+
+MotionStrip::MotionStrip(QWidget *parent)
+    : QWidget(parent)
+{
+    setFixedHeight(STRIP_HEIGHT);
+    setToolTip("모션 에너지");
+}
+
+void MotionStrip::setSegments(const QList<MotionSegment>& segments, qint64 totalMs) {
+    m_segments = segments;
+    m_totalMs = totalMs;
+    
+    m_maxEnergy = 0;
+    for (const MotionSegment& segment : m_segments) {
+        for (float value : segment.energy) {
+            m_maxEnergy = qMax(m_maxEnergy, value);
+        }
+    }
+    update();
+}
+
+bool MotionStrip::hasEnergy() const {
+    for (const MotionSegment& segment : m_segments) {
+        if (!segment.energy.isEmpty()) return true;
+    }
+    return false;
+}
+
+float MotionStrip::spikeThreshold() const {
+    double sum = 0;
+    double sumSq = 0;
+    int count = 0;
+    for (const MotionSegment& segment : m_segments) {
+        for (float value : segment.energy) {
+            sum += value;
+            sumSq += double(value) * value;
+            ++count;
+        }
+    }
+    if (count == 0) return MIN_SPIKE_THRESHOLD;
+    
+    double mean = sum / count;
+    double variance = qMax(0.0, sumSq / count - mean * mean);
+    return qMax(MIN_SPIKE_THRESHOLD, float(mean + 2.0 * qSqrt(variance)));
+}
+
+qint64 MotionStrip::nextSpike(qint64 afterMs) const {
+    const float threshold = spikeThreshold();
+    
+    // 기준값을 넘어서는 상승 지점만 스파이크로 취급
+    for (const MotionSegment& segment : m_segments) {
+        float previous = 0;
+        for (int i = 0; i < segment.energy.size(); ++i) {
+            float value = segment.energy[i];
+            qint64 timeMs = segment.offsetMs + qint64(i) * 1000;
+            if (value >= threshold && previous < threshold && timeMs > afterMs + MIN_SPIKE_DISTANCE_MS) {
+                return timeMs;
+            }
+            previous = value;
+        }
+    }
+    return -1;
+}
+
+void MotionStrip::paintEvent(QPaintEvent* event) {
+    Q_UNUSED(event);
+    QPainter painter(this);
+    painter.fillRect(rect(), palette().color(QPalette::Base));
+    if (m_totalMs <= 0 || m_maxEnergy <= 0) return;
+    
+    const double pxPerMs = double(width()) / m_totalMs;
+    for (const MotionSegment& segment : m_segments) {
+        for (int i = 0; i < segment.energy.size(); ++i) {
+            qint64 startMs = segment.offsetMs + qint64(i) * 1000;
+            qint64 endMs = qMin(startMs + 1000, segment.offsetMs + qMax(segment.durationMs, qint64(i + 1) * 1000));
+            int x0 = int(startMs * pxPerMs);
+            int x1 = qMax(x0 + 1, int(endMs * pxPerMs));
+            
+            // 낮은 에너지는 어두운 파랑, 높을수록 노랑 → 빨강
+            float level = qBound(0.0f, segment.energy[i] / m_maxEnergy, 1.0f);
+            QColor color = QColor::fromHsvF(0.66f * (1.0f - level), 0.9f, 0.35f + 0.65f * level);
+            painter.fillRect(QRect(x0, 0, x1 - x0, height()), color);
+        }
+    }
+}
@@ -0,0 +1,874 @@
+#include "../../include/video/mp4_index.h"
+#include <QSaveFile>
+#include <QtEndian>
+#include <QDebug>
+#include <algorithm>
+
+namespace {
+
+// === 빅엔디안 읽기/쓰기 도우미 ===
+
+/// 범위 검사를 포함한 순차 읽기 커서
+struct Reader {
+    const QByteArray& data;
+    qint64 pos;
+    bool ok = true;
+    
+    Reader(const QByteArray& d, qint64 p = 0) : data(d), pos(p) {}
+    
+    bool has(qint64 bytes) const { return ok && pos + bytes <= data.size(); }
+    qint64 remaining() const { return data.size() - pos; }
+    void skip(qint64 bytes) {
+        if (!has(bytes)) { ok = false; return; }
+        pos += bytes;
+    }
+    quint8 u8() {
+        if (!has(1)) { ok = false; return 0; }
+        return static_cast<quint8>(data[pos++]);
+    }
+    quint16 u16() {
+        if (!has(2)) { ok = false; return 0; }
+        quint16 v = qFromBigEndian<quint16>(data.constData() + pos);
+        pos += 2;
+        return v;
+    }
+    quint32 u32() {
+        if (!has(4)) { ok = false; return 0; }
+        quint32 v = qFromBigEndian<quint32>(data.constData() + pos);
+        pos += 4;
+        return v;
+    }
+    quint64 u64() {
+        if (!has(8)) { ok = false; return 0; }
+        quint64 v = qFromBigEndian<quint64>(data.constData() + pos);
+        pos += 8;
+        return v;
+    }
+};
+
+void appendU32(QByteArray& out, quint32 value) {
+    char buf[4];
+    qToBigEndian(value, buf);
+    out.append(buf, 4);
+}
+
+void appendU64(QByteArray& out, quint64 value) {
+    char buf[8];
+    qToBigEndian(value, buf);
+    out.append(buf, 8);
+}
+
+QByteArray makeBox(const QByteArray& type, const QByteArray& payload) {
+    QByteArray box;
+    box.reserve(payload.size() + 8);
+    appendU32(box, static_cast<quint32>(payload.size() + 8));
+    box.append(type);
+    box.append(payload);
+    return box;
+}
+
+QByteArray makeFullBox(const QByteArray& type, quint8 version, quint32 flags, const QByteArray& payload) {
+    QByteArray body;
+    appendU32(body, (static_cast<quint32>(version) << 24) | (flags & 0xFFFFFF));
+    body.append(payload);
+    return makeBox(type, body);
+}
+
+/// mvhd/tkhd/mdhd의 duration 필드 덮어쓰기 (버전별 위치가 다름)
+void patchDuration(QByteArray& payload, int v0Offset, int v1Offset, quint64 duration) {
+    if (payload.isEmpty()) return;
+    bool version1 = static_cast<quint8>(payload[0]) == 1;
+    int offset = version1 ? v1Offset : v0Offset;
+    if (version1 && offset + 8 <= payload.size()) {
+        qToBigEndian<quint64>(duration, payload.data() + offset);
+    } else if (!version1 && offset + 4 <= payload.size()) {
+        qToBigEndian<quint32>(static_cast<quint32>(qMin<quint64>(duration, 0xFFFFFFFFu)), payload.data() + offset);
+    }
+}
+
+bool isContainer(const QByteArray& type) {
+    static const char* const containers[] = {"moov", "trak", "mdia", "minf", "stbl", "edts", "dinf"};
+    for (const char* name : containers) {
+        if (type == name) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+Mp4TopLevelScan Mp4Index::scanTopLevel(const QByteArray& data, qint64 dataOffset) {
+    Mp4TopLevelScan scan;
+    qint64 pos = 0;
+    
+    while (pos + 8 <= data.size()) {
+        Reader header(data, pos);
+        quint64 size = header.u32();
+        QByteArray type = data.mid(pos + 4, 4);
+        qint64 headerSize = 8;
+        
+        if (size == 1) {
+            if (!header.has(8)) break;
+            size = header.u64();
+            headerSize = 16;
+        } else if (size == 0) {
+            // 파일 끝까지 이어지는 박스 (보통 마지막 mdat)
+            if (type == "moov") {
+                scan.moovOffset = dataOffset + pos;
+                scan.moovSize = -1;
+            }
+            return scan;
+        }
+        
+        if (size < static_cast<quint64>(headerSize)) {
+            // 손상된 박스
+            return scan;
+        }
+        
+        if (type == "moov") {
+            scan.moovOffset = dataOffset + pos;
+            scan.moovSize = static_cast<qint64>(size);
+            return scan;
+        }
+        if (type == "moof" || type == "mvex") {
+            scan.fragmented = true;
+            return scan;
+        }
+        if (type == "ftyp" && pos + static_cast<qint64>(size) <= data.size()) {
+            scan.ftyp = data.mid(pos, static_cast<qint64>(size));
+        }
+        
+        pos += static_cast<qint64>(size);
+    }
+    
+    scan.nextOffset = dataOffset + pos;
+    return scan;
+}
+
+bool Mp4Index::parseBoxes(const QByteArray& data, qint64 begin, qint64 end, std::vector<Box>& boxes, int depth) {
+    if (depth > MAX_BOX_DEPTH) return false;
+    
+    qint64 pos = begin;
+    while (pos + 8 <= end) {
+        Reader header(data, pos);
+        quint64 size = header.u32();
+        qint64 headerSize = 8;
+        if (size == 1) {
+            size = header.u64();
+            headerSize = 16;
+        } else if (size == 0) {
+            size = static_cast<quint64>(end - pos);
+        }
+        if (!header.ok || size < static_cast<quint64>(headerSize) || pos + static_cast<qint64>(size) > end) {
+            return false;
+        }
+        
+        Box box;
+        box.type = data.mid(pos + 4, 4);
+        box.container = isContainer(box.type);
+        qint64 bodyBegin = pos + headerSize;
+        qint64 bodyEnd = pos + static_cast<qint64>(size);
+        if (box.container) {
+            if (!parseBoxes(data, bodyBegin, bodyEnd, box.children, depth + 1)) return false;
+        } else {
+            box.payload = data.mid(bodyBegin, bodyEnd - bodyBegin);
+        }
+        boxes.push_back(box);
+        pos = bodyEnd;
+    }
+    return true;
+}
+
+const Mp4Index::Box* Mp4Index::findChild(const Box& parent, const char* type) {
+    for (const Box& child : parent.children) {
+        if (child.type == type) return &child;
+    }
+    return nullptr;
+}
+
+bool Mp4Index::parse(const QByteArray& moov, qint64 fileSize) {
+    m_tracks.clear();
+    m_error.clear();
+    m_fileSize = fileSize;
+    
+    std::vector<Box> top;
+    if (!parseBoxes(moov, 0, moov.size(), top, 0) || top.empty() || top.front().type != "moov") {
+        m_error = "Invalid moov box";
+        return false;
+    }
+    m_moov = top.front();
+    
+    if (findChild(m_moov, "mvex")) {
+        m_error = "Fragmented MP4 is not supported";
+        return false;
+    }
+    
+    // mvhd: timescale, duration
+    const Box* mvhd = findChild(m_moov, "mvhd");
+    if (!mvhd) {
+        m_error = "Missing mvhd";
+        return false;
+    }
+    Reader r(mvhd->payload);
+    quint8 version = r.u8();
+    r.skip(3);
+    if (version == 1) {
+        r.skip(16);
+        m_movieTimescale = r.u32();
+        m_movieDuration = r.u64();
+    } else {
+        r.skip(8);
+        m_movieTimescale = r.u32();
+        m_movieDuration = r.u32();
+    }
+    if (!r.ok || m_movieTimescale == 0) {
+        m_error = "Invalid mvhd";
+        return false;
+    }
+    
+    int trakIndex = 0;
+    for (const Box& child : m_moov.children) {
+        if (child.type != "trak") continue;
+        if (!parseTrack(child, trakIndex)) {
+            return false;
+        }
+        ++trakIndex;
+    }
+    
+    if (m_tracks.isEmpty()) {
+        m_error = "No tracks";
+        return false;
+    }
+    return true;
+}
+
+bool Mp4Index::parseTrack(const Box& trak, int trakIndex) {
+    Mp4Track track;
+    track.trakIndex = trakIndex;
+    
+    const Box* tkhd = findChild(trak, "tkhd");
+    const Box* mdia = findChild(trak, "mdia");
+    if (!tkhd || !mdia) {
+        m_error = "Incomplete trak";
+        return false;
+    }
+    
+    Reader tk(tkhd->payload);
+    quint8 tkVersion = tk.u8();
+    tk.skip(3 + (tkVersion == 1 ? 16 : 8));
+    track.trackId = tk.u32();
+    
+    const Box* mdhd = findChild(*mdia, "mdhd");
+    const Box* hdlr = findChild(*mdia, "hdlr");
+    const Box* minf = findChild(*mdia, "minf");
+    const Box* stbl = minf ? findChild(*minf, "stbl") : nullptr;
+    if (!mdhd || !hdlr || !stbl) {
+        m_error = "Incomplete mdia";
+        return false;
+    }
+    
+    Reader md(mdhd->payload);
+    quint8 mdVersion = md.u8();
+    md.skip(3 + (mdVersion == 1 ? 16 : 8));
+    track.timescale = md.u32();
+    track.handlerType = hdlr->payload.mid(8, 4);
+    
+    if (!tk.ok || !md.ok || track.timescale == 0) {
+        m_error = "Invalid track header";
+        return false;
+    }
+    
+    if (!parseSampleTable(*stbl, track)) {
+        return false;
+    }
+    
+    m_tracks.append(track);
+    return true;
+}
+
+bool Mp4Index::parseSampleTable(const Box& stbl, Mp4Track& track) {
+    const Box* stts = findChild(stbl, "stts");
+    const Box* stsc = findChild(stbl, "stsc");
+    const Box* stsz = findChild(stbl, "stsz");
+    const Box* stz2 = findChild(stbl, "stz2");
+    const Box* stco = findChild(stbl, "stco");
+    const Box* co64 = findChild(stbl, "co64");
+    const Box* ctts = findChild(stbl, "ctts");
+    const Box* stss = findChild(stbl, "stss");
+    
+    if (!stts || !stsc || !(stsz || stz2) || !(stco || co64)) {
+        m_error = "Incomplete sample table";
+        return false;
+    }
+    
+    // stts의 총 샘플 수 (고정 크기 stsz는 바이트 없이 개수만 있으므로 이 값으로 제한)
+    qint64 sttsSamples = 0;
+    {
+        Reader r(stts->payload);
+        r.skip(4);
+        quint32 entries = r.u32();
+        if (!r.ok || entries > r.remaining() / 8) { m_error = "Invalid stts"; return false; }
+        for (quint32 e = 0; e < entries; ++e) {
+            sttsSamples += r.u32();
+            r.skip(4);
+            if (sttsSamples > MAX_SAMPLES) { m_error = "Too many samples in stts"; return false; }
+        }
+    }
+    
+    // 샘플 크기 (stsz 또는 stz2), 개수는 박스 크기를 넘을 수 없음
+    QList<quint32> sizes;
+    if (stsz) {
+        Reader r(stsz->payload);
+        r.skip(4);
+        quint32 fixedSize = r.u32();
+        quint32 count = r.u32();
+        if (!r.ok) { m_error = "Invalid stsz"; return false; }
+        if (count > MAX_SAMPLES || (fixedSize != 0 ? count > sttsSamples : count > r.remaining() / 4)) {
+            m_error = "Invalid stsz sample count";
+            return false;
+        }
+        // 고정 크기 샘플의 데이터 총량은 원본 파일보다 클 수 없음
+        if (fixedSize != 0 && m_fileSize > 0 && qint64(count) * fixedSize > m_fileSize) {
+            m_error = "stsz sample data exceeds file size";
+            return false;
+        }
+        sizes.reserve(count);
+        for (quint32 i = 0; i < count && r.ok; ++i) {
+            sizes.append(fixedSize != 0 ? fixedSize : r.u32());
+        }
+        if (!r.ok) { m_error = "Invalid stsz"; return false; }
+    } else {
+        Reader r(stz2->payload);
+        r.skip(7);
+        quint8 fieldSize = r.u8();
+        quint32 count = r.u32();
+        if (!r.ok || count > MAX_SAMPLES || (fieldSize != 4 && fieldSize != 8 && fieldSize != 16)
+            || qint64(count) * fieldSize > r.remaining() * 8 + 4) {
+            m_error = "Invalid stz2";
+            return false;
+        }
+        sizes.reserve(count);
+        for (quint32 i = 0; i < count && r.ok; ++i) {
+            if (fieldSize == 4) {
+                quint8 pair = r.u8();
+                sizes.append(pair >> 4);
+                if (++i < count) sizes.append(pair & 0x0F);
+            } else if (fieldSize == 8) {
+                sizes.append(r.u8());
+            } else {
+                sizes.append(r.u16());
+            }
+        }
+        if (!r.ok) { m_error = "Invalid stz2"; return false; }
+    }
+    
+    const qint64 sampleCount = sizes.size();
+    track.samples.resize(sampleCount);
+    
+    // 디코딩 시간 (stts)
+    {
+        Reader r(stts->payload);
+        r.skip(4);
+        quint32 entries = r.u32();
+        qint64 sample = 0;
+        qint64 dts = 0;
+        for (quint32 e = 0; e < entries && r.ok; ++e) {
+            quint32 count = r.u32();
+            quint32 delta = r.u32();
+            for (quint32 i = 0; i < count && sample < sampleCount; ++i, ++sample) {
+                track.samples[sample].dts = dts;
+                track.samples[sample].duration = delta;
+                dts += delta;
+            }
+        }
+        if (!r.ok || sample != sampleCount) { m_error = "Invalid stts"; return false; }
+    }
+    
+    // 표시 시간 오프셋 (ctts)
+    if (ctts) {
+        track.hasCtts = true;
+        Reader r(ctts->payload);
+        r.skip(4);
+        quint32 entries = r.u32();
+        qint64 sample = 0;
+        for (quint32 e = 0; e < entries && r.ok; ++e) {
+            quint32 count = r.u32();
+            qint32 offset = static_cast<qint32>(r.u32());
+            for (quint32 i = 0; i < count && sample < sampleCount; ++i, ++sample) {
+                track.samples[sample].ctsOffset = offset;
+            }
+        }
+        if (!r.ok) { m_error = "Invalid ctts"; return false; }
+    }
+    
+    // 동기 샘플 (stss가 없으면 모든 샘플이 키프레임)
+    if (stss) {
+        track.hasStss = true;
+        for (Mp4Sample& sample : track.samples) sample.keyframe = false;
+        Reader r(stss->payload);
+        r.skip(4);
+        quint32 entries = r.u32();
+        for (quint32 e = 0; e < entries && r.ok; ++e) {
+            quint32 number = r.u32();
+            if (number >= 1 && number <= static_cast<quint32>(sampleCount)) {
+                track.samples[number - 1].keyframe = true;
+            }
+        }
+        if (!r.ok) { m_error = "Invalid stss"; return false; }
+    }
+    
+    // 청크 위치 (stco/co64)
+    QList<qint64> chunkOffsets;
+    {
+        Reader r(co64 ? co64->payload : stco->payload);
+        r.skip(4);
+        quint32 entries = r.u32();
+        if (!r.ok || entries > r.remaining() / (co64 ? 8 : 4)) {
+            m_error = "Invalid chunk offsets";
+            return false;
+        }
+        chunkOffsets.reserve(entries);
+        for (quint32 e = 0; e < entries && r.ok; ++e) {
+            chunkOffsets.append(co64 ? static_cast<qint64>(r.u64()) : static_cast<qint64>(r.u32()));
+        }
+        if (!r.ok) { m_error = "Invalid chunk offsets"; return false; }
+    }
+    
+    // 청크-샘플 매핑 (stsc)으로 샘플별 파일 위치 계산
+    {
+        struct StscEntry { quint32 firstChunk; quint32 samplesPerChunk; quint32 descIndex; };
+        QList<StscEntry> runs;
+        Reader r(stsc->payload);
+        r.skip(4);
+        quint32 entries = r.u32();
+        for (quint32 e = 0; e < entries && r.ok; ++e) {
+            StscEntry entry;
+            entry.firstChunk = r.u32();
+            entry.samplesPerChunk = r.u32();
+            entry.descIndex = r.u32();
+            runs.append(entry);
+        }
+        if (!r.ok || runs.isEmpty()) { m_error = "Invalid stsc"; return false; }
+        
+        qint64 sample = 0;
+        for (int run = 0; run < runs.size() && sample < sampleCount; ++run) {
+            quint32 firstChunk = runs[run].firstChunk;
+            quint32 lastChunk = (run + 1 < runs.size())
+                ? runs[run + 1].firstChunk - 1
+                : static_cast<quint32>(chunkOffsets.size());
+            for (quint32 chunk = firstChunk; chunk <= lastChunk && sample < sampleCount; ++chunk) {
+                if (chunk == 0 || chunk > static_cast<quint32>(chunkOffsets.size())) {
+                    m_error = "Invalid stsc chunk index";
+                    return false;
+                }
+                qint64 offset = chunkOffsets[chunk - 1];
+                for (quint32 i = 0; i < runs[run].samplesPerChunk && sample < sampleCount; ++i, ++sample) {
+                    track.samples[sample].offset = offset;
+                    track.samples[sample].size = sizes[sample];
+                    track.samples[sample].descIndex = runs[run].descIndex;
+                    offset += sizes[sample];
+                }
+            }
+        }
+        if (sample != sampleCount) { m_error = "Sample table mismatch"; return false; }
+    }
+    
+    return true;
+}
+
+const Mp4Track* Mp4Index::primaryTrack() const {
+    for (const Mp4Track& track : m_tracks) {
+        if (track.handlerType == "vide") return &track;
+    }
+    return m_tracks.isEmpty() ? nullptr : &m_tracks.first();
+}
+
+const Mp4Track* Mp4Index::trackForTrak(int trakIndex) const {
+    for (const Mp4Track& track : m_tracks) {
+        if (track.trakIndex == trakIndex) return &track;
+    }
+    return nullptr;
+}
+
+qint64 Mp4Index::durationMs() const {
+    return m_movieTimescale ? static_cast<qint64>(m_movieDuration * 1000 / m_movieTimescale) : 0;
+}
+
+bool Mp4Index::selectRange(qint64 startMs, qint64 endMs) {
+    const Mp4Track* primary = primaryTrack();
+    if (!primary || primary->samples.isEmpty() || endMs <= startMs) {
+        m_error = "Invalid range";
+        return false;
+    }
+    
+    // 1. 기준(비디오) 트랙: 시작 시간 이전의 키프레임부터
+    int primaryIndex = 0;
+    for (int i = 0; i < m_tracks.size(); ++i) {
+        if (&m_tracks[i] == primary) primaryIndex = i;
+    }
+    Mp4Track& base = m_tracks[primaryIndex];
+    
+    const qint64 startTs = startMs * base.timescale / 1000;
+    const qint64 endTs = endMs * base.timescale / 1000;
+    
+    int first = 0;
+    while (first < base.samples.size() - 1
+           && base.samples[first].dts + base.samples[first].duration <= startTs) {
+        ++first;
+    }
+    while (first > 0 && !base.samples[first].keyframe) {
+        --first;
+    }
+    int last = first;
+    while (last + 1 < base.samples.size() && base.samples[last + 1].dts < endTs) {
+        ++last;
+    }
+    base.firstSelected = first;
+    base.lastSelected = last;
+    
+    // 2. 나머지 트랙: 실제 시작 시간(키프레임)부터 끝 시간까지
+    const double beginSec = static_cast<double>(base.samples[first].dts) / base.timescale;
+    const double endSec = static_cast<double>(endTs) / base.timescale;
+    for (int i = 0; i < m_tracks.size(); ++i) {
+        if (i == primaryIndex) continue;
+        Mp4Track& track = m_tracks[i];
+        track.firstSelected = -1;
+        track.lastSelected = -1;
+        const qint64 trackBegin = static_cast<qint64>(beginSec * track.timescale);
+        const qint64 trackEnd = static_cast<qint64>(endSec * track.timescale);
+        for (int s = 0; s < track.samples.size(); ++s) {
+            const Mp4Sample& sample = track.samples[s];
+            if (sample.dts + sample.duration <= trackBegin) continue;
+            if (sample.dts >= trackEnd) break;
+            if (track.firstSelected < 0) {
+                // 키프레임이 아니면 다음 동기 샘플부터
+                if (!sample.keyframe) continue;
+                track.firstSelected = s;
+            }
+            track.lastSelected = s;
+        }
+    }
+    return true;
+}
+
+qint64 Mp4Index::selectedStartMs() const {
+    const Mp4Track* primary = primaryTrack();
+    if (!primary || primary->firstSelected < 0) return 0;
+    return primary->samples[primary->firstSelected].dts * 1000 / primary->timescale;
+}
+
+qint64 Mp4Index::selectedBytes() const {
+    qint64 total = 0;
+    for (const Mp4Track& track : m_tracks) {
+        if (track.firstSelected < 0) continue;
+        for (int s = track.firstSelected; s <= track.lastSelected; ++s) {
+            total += track.samples[s].size;
+        }
+    }
+    return total;
+}
+
+QList<Mp4ByteRange> Mp4Index::requiredRanges(qint64 mergeGap) const {
+    QList<Mp4ByteRange> ranges;
+    for (const Mp4Track& track : m_tracks) {
+        if (track.firstSelected < 0) continue;
+        for (int s = track.firstSelected; s <= track.lastSelected; ++s) {
+            Mp4ByteRange range;
+            range.offset = track.samples[s].offset;
+            range.length = track.samples[s].size;
+            ranges.append(range);
+        }
+    }
+    
+    std::sort(ranges.begin(), ranges.end(), [](const Mp4ByteRange& a, const Mp4ByteRange& b) {
+        return a.offset < b.offset;
+    });
+    
+    // 인접하거나 가까운 구간 병합 (요청 수 감소)
+    QList<Mp4ByteRange> merged;
+    for (const Mp4ByteRange& range : ranges) {
+        if (!merged.isEmpty()) {
+            Mp4ByteRange& back = merged.last();
+            qint64 backEnd = back.offset + back.length;
+            if (range.offset <= backEnd + mergeGap) {
+                back.length = qMax(backEnd, range.offset + range.length) - back.offset;
+                continue;
+            }
+        }
+        merged.append(range);
+    }
+    return merged;
+}
+
+quint64 Mp4Index::selectedMediaDuration(const Mp4Track& track) const {
+    quint64 duration = 0;
+    for (int s = track.firstSelected; s >= 0 && s <= track.lastSelected; ++s) {
+        duration += track.samples[s].duration;
+    }
+    return duration;
+}
+
+QByteArray Mp4Index::serialize(const Box& box) {
+    if (!box.container) {
+        return makeBox(box.type, box.payload);
+    }
+    QByteArray body;
+    for (const Box& child : box.children) {
+        body.append(serialize(child));
+    }
+    return makeBox(box.type, body);
+}
+
+QByteArray Mp4Index::buildStbl(const Box& stbl, const Mp4Track& track, qint64 chunkOffset) const {
+    const int first = track.firstSelected;
+    const int count = track.lastSelected - track.firstSelected + 1;
+    QByteArray body;
+    
+    // stsd는 그대로 유지 (코덱 설정)
+    if (const Box* stsd = findChild(stbl, "stsd")) {
+        body.append(serialize(*stsd));
+    }
+    
+    // stts: 샘플 길이 런렝스
+    {
+        QByteArray entries;
+        quint32 entryCount = 0;
+        for (int i = 0; i < count;) {
+            quint32 delta = track.samples[first + i].duration;
+            int run = 1;
+            while (i + run < count && track.samples[first + i + run].duration == delta) ++run;
+            appendU32(entries, static_cast<quint32>(run));
+            appendU32(entries, delta);
+            ++entryCount;
+            i += run;
+        }
+        QByteArray payload;
+        appendU32(payload, entryCount);
+        payload.append(entries);
+        body.append(makeFullBox("stts", 0, 0, payload));
+    }
+    
+    // ctts: 표시 시간 오프셋 런렝스 (음수면 version 1)
+    if (track.hasCtts) {
+        QByteArray entries;
+        quint32 entryCount = 0;
+        bool negative = false;
+        for (int i = 0; i < count;) {
+            qint32 offset = track.samples[first + i].ctsOffset;
+            negative = negative || offset < 0;
+            int run = 1;
+            while (i + run < count && track.samples[first + i + run].ctsOffset == offset) ++run;
+            appendU32(entries, static_cast<quint32>(run));
+            appendU32(entries, static_cast<quint32>(offset));
+            ++entryCount;
+            i += run;
+        }
+        QByteArray payload;
+        appendU32(payload, entryCount);
+        payload.append(entries);
+        body.append(makeFullBox("ctts", negative ? 1 : 0, 0, payload));
+    }
+    
+    // stss: 새 번호로 키프레임 목록
+    if (track.hasStss) {
+        QByteArray entries;
+        quint32 entryCount = 0;
+        for (int i = 0; i < count; ++i) {
+            if (track.samples[first + i].keyframe) {
+                appendU32(entries, static_cast<quint32>(i + 1));
+                ++entryCount;
+            }
+        }
+        QByteArray payload;
+        appendU32(payload, entryCount);
+        payload.append(entries);
+        body.append(makeFullBox("stss", 0, 0, payload));
+    }
+    
+    // stsc: 트랙당 청크 하나
+    {
+        QByteArray payload;
+        appendU32(payload, 1);
+        appendU32(payload, 1);
+        appendU32(payload, static_cast<quint32>(count));
+        appendU32(payload, track.samples[first].descIndex);
+        body.append(makeFullBox("stsc", 0, 0, payload));
+    }
+    
+    // stsz: 샘플 크기
+    {
+        bool uniform = true;
+        for (int i = 1; i < count && uniform; ++i) {
+            uniform = track.samples[first + i].size == track.samples[first].size;
+        }
+        QByteArray payload;
+        appendU32(payload, uniform ? track.samples[first].size : 0);
+        appendU32(payload, static_cast<quint32>(count));
+        if (!uniform) {
+            for (int i = 0; i < count; ++i) {
+                appendU32(payload, track.samples[first + i].size);
+            }
+        }
+        body.append(makeFullBox("stsz", 0, 0, payload));
+    }
+    
+    // co64: 청크 위치
+    {
+        QByteArray payload;
+        appendU32(payload, 1);
+        appendU64(payload, static_cast<quint64>(chunkOffset));
+        body.append(makeFullBox("co64", 0, 0, payload));
+    }
+    
+    return makeBox("stbl", body);
+}
+
+QByteArray Mp4Index::buildTrak(const Box& trak, const Mp4Track& track, qint64 chunkOffset) const {
+    const quint64 mediaDuration = selectedMediaDuration(track);
+    const quint64 movieDuration = mediaDuration * m_movieTimescale / track.timescale;
+    
+    QByteArray trakBody;
+    for (const Box& child : trak.children) {
+        if (child.type == "edts") {
+            // 편집 목록은 원본 타임라인 기준이므로 제거
+            continue;
+        }
+        if (child.type == "tkhd") {
+            Box tkhd = child;
+            patchDuration(tkhd.payload, 20, 28, movieDuration);
+            trakBody.append(serialize(tkhd));
+            continue;
+        }
+        if (child.type != "mdia") {
+            trakBody.append(serialize(child));
+            continue;
+        }
+        
+        QByteArray mdiaBody;
+        for (const Box& mdiaChild : child.children) {
+            if (mdiaChild.type == "mdhd") {
+                Box mdhd = mdiaChild;
+                patchDuration(mdhd.payload, 16, 24, mediaDuration);
+                mdiaBody.append(serialize(mdhd));
+            } else if (mdiaChild.type == "minf") {
+                QByteArray minfBody;
+                for (const Box& minfChild : mdiaChild.children) {
+                    if (minfChild.type == "stbl") {
+                        minfBody.append(buildStbl(minfChild, track, chunkOffset));
+                    } else {
+                        minfBody.append(serialize(minfChild));
+                    }
+                }
+                mdiaBody.append(makeBox("minf", minfBody));
+            } else {
+                mdiaBody.append(serialize(mdiaChild));
+            }
+        }
+        trakBody.append(makeBox("mdia", mdiaBody));
+    }
+    return makeBox("trak", trakBody);
+}
+
+QByteArray Mp4Index::buildMoov(const QMap<int, qint64>& trackDataOffsets) const {
+    quint64 movieDuration = 0;
+    for (const Mp4Track& track : m_tracks) {
+        if (track.firstSelected < 0) continue;
+        movieDuration = qMax<quint64>(movieDuration,
+            selectedMediaDuration(track) * m_movieTimescale / track.timescale);
+    }
+    
+    QByteArray moovBody;
+    int trakIndex = 0;
+    for (const Box& child : m_moov.children) {
+        if (child.type == "mvhd") {
+            Box mvhd = child;
+            patchDuration(mvhd.payload, 16, 24, movieDuration);
+            moovBody.append(serialize(mvhd));
+        } else if (child.type == "trak") {
+            const Mp4Track* track = trackForTrak(trakIndex++);
+            if (track && track->firstSelected >= 0) {
+                moovBody.append(buildTrak(child, *track, trackDataOffsets.value(track->trakIndex)));
+            }
+        } else {
+            moovBody.append(serialize(child));
+        }
+    }
+    return makeBox("moov", moovBody);
+}
+
+bool Mp4Index::writeClip(const QString& path, const QMap<qint64, QByteArray>& rangeData,
+                         const QByteArray& ftyp) const {
+    // 트랙별 mdat 내 상대 위치와 데이터 크기
+    QMap<int, qint64> relativeOffsets;
+    qint64 mdatPayload = 0;
+    for (const Mp4Track& track : m_tracks) {
+        if (track.firstSelected < 0) continue;
+        relativeOffsets[track.trakIndex] = mdatPayload;
+        for (int s = track.firstSelected; s <= track.lastSelected; ++s) {
+            mdatPayload += track.samples[s].size;
+        }
+    }
+    
+    QByteArray ftypBox = ftyp;
+    if (ftypBox.isEmpty()) {
+        QByteArray payload("isom");
+        appendU32(payload, 0x200);
+        payload.append("isomiso2avc1mp41");
+        ftypBox = makeBox("ftyp", payload);
+    }
+    
+    // moov 크기는 위치 값과 무관하므로 한 번 계산 후 실제 위치로 다시 작성
+    const bool largeMdat = mdatPayload + 8 > 0xFFFFFFFFLL;
+    const qint64 mdatHeader = largeMdat ? 16 : 8;
+    const qint64 moovSize = buildMoov(relativeOffsets).size();
+    const qint64 dataStart = ftypBox.size() + moovSize + mdatHeader;
+    
+    QMap<int, qint64> absoluteOffsets;
+    for (auto it = relativeOffsets.cbegin(); it != relativeOffsets.cend(); ++it) {
+        absoluteOffsets[it.key()] = dataStart + it.value();
+    }
+    QByteArray moov = buildMoov(absoluteOffsets);
+    
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Cannot write clip:" << path;
+        return false;
+    }
+    
+    file.write(ftypBox);
+    file.write(moov);
+    
+    QByteArray header;
+    if (largeMdat) {
+        appendU32(header, 1);
+        header.append("mdat");
+        appendU64(header, static_cast<quint64>(mdatPayload + 16));
+    } else {
+        appendU32(header, static_cast<quint32>(mdatPayload + 8));
+        header.append("mdat");
+    }
+    file.write(header);
+    
+    // 샘플 데이터를 받은 구간에서 잘라 트랙 순서대로 기록
+    for (const Mp4Track& track : m_tracks) {
+        if (track.firstSelected < 0) continue;
+        for (int s = track.firstSelected; s <= track.lastSelected; ++s) {
+            const Mp4Sample& sample = track.samples[s];
+            auto it = rangeData.upperBound(sample.offset);
+            if (it == rangeData.cbegin()) {
+                qWarning() << "Missing sample data at" << sample.offset;
+                file.cancelWriting();
+                return false;
+            }
+            --it;
+            qint64 local = sample.offset - it.key();
+            if (local + sample.size > it.value().size()) {
+                qWarning() << "Incomplete sample data at" << sample.offset;
+                file.cancelWriting();
+                return false;
+            }
+            file.write(it.value().constData() + local, sample.size);
+        }
+    }
+    
+    return file.commit();
+}
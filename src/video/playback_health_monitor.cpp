@@ -0,0 +1,211 @@
+#include "../../include/video/playback_health_monitor.h"
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QStandardPaths>
+#include <QTextStream>
+#include <QDebug>
+
+PlaybackHealthMonitor::PlaybackHealthMonitor(const QString& playerName, QObject *parent)
+    : QObject(parent)
+    , m_playerName(playerName)
+{
+    m_clock.start();
+    m_sampleTimer.setInterval(SAMPLE_INTERVAL_MS);
+    connect(&m_sampleTimer, &QTimer::timeout, this, &PlaybackHealthMonitor::sample);
+}
+
+void PlaybackHealthMonitor::attach(QMediaPlayer* player, QVideoSink* sink) {
+    if (m_sink) {
+        disconnect(m_sink, nullptr, this, nullptr);
+    }
+    if (m_player) {
+        disconnect(m_player, nullptr, this, nullptr);
+    }
+    m_player = player;
+    m_sink = sink;
+    
+    // 프레임 간격 계산이 이전 플레이어의 타임스탬프와 섞이지 않도록 초기화
+    m_lastTimestampUs = -1;
+    m_lastArrivalNs = -1;
+    
+    if (m_sink) {
+        connect(m_sink, &QVideoSink::videoFrameChanged, this, &PlaybackHealthMonitor::onFrame,
+                Qt::DirectConnection);
+    }
+    
+    // 샘플링은 재생이 시작될 때만 (풀에 대기 중인 숨은 플레이어는 타이머를 돌리지 않음)
+    if (m_player) {
+        connect(m_player, &QMediaPlayer::playbackStateChanged, this, [this](QMediaPlayer::PlaybackState state) {
+            if (state == QMediaPlayer::PlayingState) {
+                startSampling();
+            }
+        });
+        if (m_player->playbackState() == QMediaPlayer::PlayingState) {
+            startSampling();
+        }
+    }
+}
+
+void PlaybackHealthMonitor::stop() {
+    // 재생 중이었으면 멈춘 상태를 한 번 기록하고 정지
+    if (m_sampleTimer.isActive()) {
+        sample();
+    }
+    m_sampleTimer.stop();
+    m_wasPlaying = false;
+}
+
+void PlaybackHealthMonitor::startSampling() {
+    if (m_sampleTimer.isActive()) return;
+    
+    // 쉬는 동안의 시간이 첫 FPS에 섞이지 않도록 기준점 갱신
+    m_lastSampleFrames = m_frames.load(std::memory_order_relaxed);
+    m_lastSampleNs = m_clock.nsecsElapsed();
+    m_sampleTimer.start();
+}
+
+void PlaybackHealthMonitor::markSeek() {
+    m_seekStartNs = m_clock.nsecsElapsed();
+}
+
+void PlaybackHealthMonitor::resetCounters() {
+    m_frames = 0;
+    m_dropped = 0;
+    m_late = 0;
+    m_lastTimestampUs = -1;
+    m_lastArrivalNs = -1;
+    m_seekStartNs = -1;
+    m_seekLatencyNs = -1;
+    m_lastSampleFrames = 0;
+    m_lastSampleNs = m_clock.nsecsElapsed();
+}
+
+void PlaybackHealthMonitor::onFrame(const QVideoFrame& frame) {
+    if (!frame.isValid()) return;
+    
+    qint64 nowNs = m_clock.nsecsElapsed();
+    qint64 timestampUs = frame.startTime();
+    qint64 previousUs = m_lastTimestampUs.exchange(timestampUs, std::memory_order_relaxed);
+    qint64 previousArrivalNs = m_lastArrivalNs.exchange(nowNs, std::memory_order_relaxed);
+    m_frames.fetch_add(1, std::memory_order_relaxed);
+    m_frameWidth.store(frame.width(), std::memory_order_relaxed);
+    m_frameHeight.store(frame.height(), std::memory_order_relaxed);
+    
+    // 탐색 후 첫 프레임: 지연만 기록하고 간격 계산은 건너뜀
+    qint64 seekStartNs = m_seekStartNs.exchange(-1, std::memory_order_relaxed);
+    if (seekStartNs >= 0) {
+        m_seekLatencyNs.store(nowNs - seekStartNs, std::memory_order_relaxed);
+        return;
+    }
+    if (timestampUs < 0 || previousUs < 0 || timestampUs <= previousUs) return;
+    
+    qint64 frameUs = frame.endTime() > timestampUs ? frame.endTime() - timestampUs : DEFAULT_FRAME_US;
+    qint64 gapUs = timestampUs - previousUs;
+    if (gapUs * 2 > frameUs * 3) {
+        m_dropped.fetch_add((gapUs + frameUs / 2) / frameUs - 1, std::memory_order_relaxed);
+    }
+    
+    // 재생 속도를 감안한 기대 도착 간격의 2배를 넘으면 지연
+    int rateMilli = qMax(1, m_rateMilli.load(std::memory_order_relaxed));
+    qint64 expectedNs = gapUs * 1000 * 1000 / rateMilli;
+    if (previousArrivalNs >= 0 && nowNs - previousArrivalNs > 2 * expectedNs) {
+        m_late.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void PlaybackHealthMonitor::sample() {
+    qint64 nowNs = m_clock.nsecsElapsed();
+    qint64 frames = m_frames.load(std::memory_order_relaxed);
+    double fps = nowNs > m_lastSampleNs
+        ? (frames - m_lastSampleFrames) * 1e9 / (nowNs - m_lastSampleNs)
+        : 0.0;
+    m_lastSampleFrames = frames;
+    m_lastSampleNs = nowNs;
+    
+    bool playing = m_player && m_player->playbackState() == QMediaPlayer::PlayingState;
+    if (!playing) {
+        // 일시정지 후 재개한 첫 프레임을 지연으로 세지 않음
+        m_lastArrivalNs = -1;
+    }
+    if (m_player) {
+        m_rateMilli = static_cast<int>(m_player->playbackRate() * 1000);
+    }
+    float buffer = m_player ? m_player->bufferProgress() : 0.0f;
+    qint64 seekLatencyNs = m_seekLatencyNs.load(std::memory_order_relaxed);
+    
+    m_summary = QString("%1 fps | dropped %2 | late %3 | buffer %4% | seek %5 | %6x%7 | %8")
+        .arg(fps, 0, 'f', 1)
+        .arg(m_dropped.load(std::memory_order_relaxed))
+        .arg(m_late.load(std::memory_order_relaxed))
+        .arg(qRound(buffer * 100))
+        .arg(seekLatencyNs >= 0 ? QString("%1 ms").arg(seekLatencyNs / 1000000) : QString("-"))
+        .arg(m_frameWidth.load(std::memory_order_relaxed))
+        .arg(m_frameHeight.load(std::memory_order_relaxed))
+        .arg(backendName());
+    emit sampled(m_summary);
+    
+    // 재생 중이거나 막 멈춘 경우만 기록 (유휴 창은 로그를 채우지 않음)
+    if (playing || m_wasPlaying) {
+        logEvent(m_summary);
+    }
+    m_wasPlaying = playing;
+    
+    // 멈춘 뒤에는 다음 재생 시작까지 샘플링하지 않음
+    if (!playing) {
+        m_sampleTimer.stop();
+    }
+}
+
+QString PlaybackHealthMonitor::backendName() {
+    // 실행 중에는 바뀌지 않으므로 한 번만 계산
+    static const QString name = detectBackendName();
+    return name;
+}
+
+QString PlaybackHealthMonitor::detectBackendName() {
+    QString backend = qEnvironmentVariable("QT_MEDIA_BACKEND");
+    if (!backend.isEmpty()) {
+        return backend;
+    }
+    
+    // 환경 변수가 없으면 Qt 버전/플랫폼으로 추정한 값이므로 실제 감지값과 구분해 표시
+#if QT_VERSION >= QT_VERSION_CHECK(6, 5, 0) && !defined(Q_OS_ANDROID)
+    backend = "ffmpeg";
+#elif defined(Q_OS_WIN)
+    backend = "windows";
+#elif defined(Q_OS_DARWIN)
+    backend = "darwin";
+#elif defined(Q_OS_ANDROID)
+    backend = "android";
+#else
+    backend = "gstreamer";
+#endif
+    return QString("%1 (expected)").arg(backend);
+}
+
+QString PlaybackHealthMonitor::sessionLogPath() {
+    // 프로세스당 한 파일 (시작 시각 기준)
+    static const QString path = QDir(QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation))
+        .filePath(QString("logs/playback_%1.log")
+                  .arg(QDateTime::currentDateTime().toString("yyyyMMdd_hhmmss")));
+    return path;
+}
+
+void PlaybackHealthMonitor::logEvent(const QString& line) {
+    static QFile* log = nullptr;
+    if (!log) {
+        QString path = sessionLogPath();
+        QDir().mkpath(QFileInfo(path).absolutePath());
+        log = new QFile(path, QCoreApplication::instance());
+        if (!log->open(QIODevice::Append | QIODevice::Text)) {
+            qWarning() << "Cannot open playback log:" << path;
+        }
+    }
+    if (!log->isOpen()) return;
+    
+    QTextStream out(log);
+    out << QDateTime::currentDateTime().toString("hh:mm:ss.zzz") << " [" << m_playerName << "] " << line << "\n";
+    out.flush();
+}
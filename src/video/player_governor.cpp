@@ -0,0 +1,169 @@
+#include "../../include/video/player_governor.h"
+#include <QEvent>
+#include <QFile>
+#include <QSettings>
+#include <QThread>
+#include <QDebug>
+#include <algorithm>
+
+#ifndef Q_OS_WIN
+#include <sys/resource.h>
+#endif
+
+PlayerGovernor::PlayerGovernor(int maxDecoding, QObject *parent)
+    : QObject(parent)
+    , m_maxDecoding(qBound(1, maxDecoding, MAX_DECODING_LIMIT))
+{
+    m_wallClock.start();
+    m_reportTimer.setInterval(REPORT_INTERVAL_MS);
+    connect(&m_reportTimer, &QTimer::timeout, this, &PlayerGovernor::report);
+    m_reportTimer.start();
+}
+
+int PlayerGovernor::configuredMaxDecoding() {
+    QSettings settings;
+    return settings.value("player/maxDecoding", DEFAULT_MAX_DECODING).toInt();
+}
+
+void PlayerGovernor::track(VideoPlayer* player) {
+    if (!player || m_lastUsed.contains(player)) return;
+    
+    touch(player);
+    player->installEventFilter(this);
+    connect(player, &VideoPlayer::playingChanged, this, &PlayerGovernor::onPlayingChanged);
+    
+    // 새로 연 창이 상한을 넘기면 다른 창을 멈춤
+    if (player->isPlaying()) {
+        onPlayingChanged(player, true);
+    }
+    report();
+}
+
+void PlayerGovernor::untrack(VideoPlayer* player) {
+    if (!m_lastUsed.remove(player)) return;
+    
+    player->removeEventFilter(this);
+    disconnect(player, nullptr, this, nullptr);
+    report();
+}
+
+void PlayerGovernor::touch(VideoPlayer* player) {
+    m_lastUsed[player] = ++m_useCounter;
+}
+
+bool PlayerGovernor::eventFilter(QObject* watched, QEvent* event) {
+    VideoPlayer* player = qobject_cast<VideoPlayer*>(watched);
+    if (player && m_lastUsed.contains(player)) {
+        switch (event->type()) {
+        case QEvent::Show:
+        case QEvent::Hide:
+        case QEvent::WindowStateChange:
+            updateVisibility(player);
+            break;
+        case QEvent::WindowActivate:
+            touch(player);
+            break;
+        default:
+            break;
+        }
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void PlayerGovernor::updateVisibility(VideoPlayer* player) {
+    bool visible = player->isVisible() && !player->isMinimized();
+    
+    if (!visible && !player->isSuspended()) {
+        // 보이지 않는 창은 디코더까지 해제 (위치는 플레이어가 기억)
+        player->suspend();
+        qDebug() << "Suspended hidden player:" << player->windowTitle();
+        report();
+    } else if (visible && player->isSuspended()) {
+        touch(player);
+        player->resume();
+        qDebug() << "Resumed player:" << player->windowTitle();
+        report();
+    }
+}
+
+void PlayerGovernor::onPlayingChanged(VideoPlayer* player, bool playing) {
+    if (!playing) return;
+    touch(player);
+    
+    // 상한을 넘으면 가장 오래 사용하지 않은 창부터 일시정지
+    QList<VideoPlayer*> decoding;
+    for (auto it = m_lastUsed.constBegin(); it != m_lastUsed.constEnd(); ++it) {
+        if (it.key()->isPlaying()) {
+            decoding.append(it.key());
+        }
+    }
+    std::sort(decoding.begin(), decoding.end(), [this](VideoPlayer* a, VideoPlayer* b) {
+        return m_lastUsed.value(a) < m_lastUsed.value(b);
+    });
+    
+    while (decoding.size() > m_maxDecoding) {
+        VideoPlayer* oldest = decoding.takeFirst();
+        qDebug() << "Decode limit" << m_maxDecoding << "reached, pausing:" << oldest->windowTitle();
+        oldest->pause();
+    }
+}
+
+PlayerResourceStats PlayerGovernor::stats() const {
+    PlayerResourceStats stats;
+    stats.trackedPlayers = m_lastUsed.size();
+    for (auto it = m_lastUsed.constBegin(); it != m_lastUsed.constEnd(); ++it) {
+        if (it.key()->isPlaying()) ++stats.decodingPlayers;
+        if (it.key()->isSuspended()) ++stats.suspendedPlayers;
+    }
+    stats.residentBytes = residentMemory();
+    stats.cpuPercent = m_cpuPercent;
+    return stats;
+}
+
+void PlayerGovernor::report() {
+    // CPU 사용률은 직전 보고 이후 구간 기준
+    qint64 cpuMs = processCpuTimeMs();
+    qint64 wallMs = m_wallClock.elapsed();
+    if (cpuMs >= 0 && m_lastCpuMs >= 0 && wallMs > m_lastWallMs) {
+        int cores = qMax(1, QThread::idealThreadCount());
+        m_cpuPercent = 100.0 * (cpuMs - m_lastCpuMs) / (wallMs - m_lastWallMs) / cores;
+    }
+    m_lastCpuMs = cpuMs;
+    m_lastWallMs = wallMs;
+    
+    emit statsUpdated(stats());
+}
+
+qint64 PlayerGovernor::residentMemory() {
+#ifdef Q_OS_LINUX
+    QFile status("/proc/self/status");
+    if (!status.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return -1;
+    }
+    
+    // "VmRSS:    123456 kB"
+    while (!status.atEnd()) {
+        QByteArray line = status.readLine();
+        if (line.startsWith("VmRSS:")) {
+            QList<QByteArray> parts = line.simplified().split(' ');
+            return parts.size() >= 2 ? parts[1].toLongLong() * 1024 : -1;
+        }
+    }
+    return -1;
+#else
+    return -1;
+#endif
+}
+
+qint64 PlayerGovernor::processCpuTimeMs() {
+#ifdef Q_OS_WIN
+    // Windows의 clock()은 실제 경과 시간이므로 사용하지 않음
+    return -1;
+#else
+    // clock()은 32비트 clock_t(라즈베리 파이 등)에서 약 36분마다 되돌아가므로 getrusage 사용
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+    return (static_cast<qint64>(usage.ru_utime.tv_sec) + usage.ru_stime.tv_sec) * 1000
+         + (static_cast<qint64>(usage.ru_utime.tv_usec) + usage.ru_stime.tv_usec) / 1000;
+#endif
+}
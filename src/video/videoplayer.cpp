@@ -1,46 +1,202 @@
 #include "../../include/video/videoplayer.h"
+#include "../../include/video/motion_strip.h"
+#include "../../include/video/motion_analyzer.h"
+#include "../../include/video/frame_exporter.h"
+#include "../../include/video/playback_health_monitor.h"
 #include <QUrl>
 #include <QMessageBox>
 #include <QFileInfo>
 #include <QCloseEvent>
+#include <QVideoSink>
+#include <QPointer>
+#include <QDialog>
+#include <QDialogButtonBox>
+#include <QFormLayout>
+#include <QComboBox>
+#include <QSpinBox>
+#include <QCheckBox>
+#include <QFileDialog>
+#include <QProgressDialog>
+#include <QStandardPaths>
+#include <QDir>
+#include <QShortcut>
+#include <QDebug>
+#include <utility>
 
-VideoPlayer::VideoPlayer(const QString& videoPath, QWidget *parent)
+VideoPlayer::VideoPlayer(QWidget *parent)
     : QWidget(parent)
-    , m_videoPath(videoPath)
     , m_mediaPlayer(new QMediaPlayer(this))
 {
+    setupUI();
+    setupConnections();
+    
+    setWindowTitle("Video Player");
+    resize(DEFAULT_WINDOW_WIDTH, DEFAULT_WINDOW_HEIGHT);
+    
+    // 비디오 출력은 미리 연결해 두어 열기 시 백엔드 초기화 비용을 줄임
+    m_mediaPlayer->setVideoOutput(m_videoWidget);
+}
+
+VideoPlayer::VideoPlayer(const QString& videoPath, QWidget *parent)
+    : VideoPlayer(parent)
+{
+    openVideo(videoPath);
+}
+
+VideoPlayer::~VideoPlayer() = default;
+
+bool VideoPlayer::openVideo(const QString& videoPath, qint64 createdTime, qint64 startPositionMs) {
     // 비디오 파일 존재 확인
     QFileInfo fileInfo(videoPath);
     if (!fileInfo.exists() || !fileInfo.isFile()) {
-        QMessageBox::critical(this, "File Error", 
+        QMessageBox::critical(this, "File Error",
                             QString("비디오 파일을 찾을 수 없습니다: %1").arg(videoPath));
         close();
-        return;
+        return false;
     }
     
-    setupUI();
-    setupConnections();
+    // 단일 파일은 항목 하나짜리 재생 목록으로 처리
+    PlaylistEntry entry;
+    entry.localPath = videoPath;
+    entry.createdTime = createdTime;
+    return openPlaylist({entry}, 0, nullptr, startPositionMs);
+}
+
+bool VideoPlayer::openPlaylist(const QList<PlaylistEntry>& entries, int startIndex, PlaylistFetcher fetcher,
+                               qint64 startPositionMs) {
+    if (startIndex < 0 || startIndex >= entries.size() || entries[startIndex].localPath.isEmpty()) {
+        return false;
+    }
     
-    // 창 제목에 파일명 표시
-    setWindowTitle(QString("Video Player - %1").arg(fileInfo.fileName()));
-    resize(DEFAULT_WINDOW_WIDTH, DEFAULT_WINDOW_HEIGHT);
+    ++m_playlistGeneration;
+    m_playlist = entries;
+    m_fetcher = fetcher;
+    m_fetching.clear();
+    m_standbyIndex = -1;
+    m_pendingIndex = -1;
+    m_motionEnergy.clear();
+    for (const PlaylistEntry& entry : m_playlist) {
+        requestMotionAnalysis(entry.localPath);
+    }
+    updateTimelineRange();
     
     // 비디오 로드 및 재생
-    loadAndPlayVideo();
+    m_openTimer.start();
+    m_waitingFirstFrame = true;
+    m_health->resetCounters();
+    m_health->logEvent(QString("open %1 (%2 clips)")
+                       .arg(QFileInfo(entries[startIndex].localPath).fileName())
+                       .arg(entries.size()));
+    m_health->markSeek();
+    loadClip(startIndex, startPositionMs, true);
+    return true;
 }
 
-VideoPlayer::~VideoPlayer() = default;
+void VideoPlayer::reset() {
+    m_mediaPlayer->stop();
+    m_mediaPlayer->setSource(QUrl());
+    if (m_standbyPlayer) {
+        m_standbyPlayer->stop();
+        m_standbyPlayer->setSource(QUrl());
+    }
+    m_health->stop();
+    
+    // 진행 중인 다운로드 콜백은 세대 번호로 무시됨
+    ++m_playlistGeneration;
+    m_playlist.clear();
+    m_fetcher = nullptr;
+    m_fetching.clear();
+    m_currentIndex = -1;
+    m_standbyIndex = -1;
+    m_pendingIndex = -1;
+    m_seekOnLoad = -1;
+    m_videoPath.clear();
+    m_waitingFirstFrame = false;
+    m_motionEnergy.clear();
+    m_suspended = false;
+    if (m_frameExporter) {
+        m_frameExporter->cancel();
+    }
+    
+    m_positionSlider->setMaximum(0);
+    m_motionStrip->setSegments({}, 0);
+    m_nextSpikeBtn->setEnabled(false);
+    m_positionSlider->setValue(0);
+    m_timeLabel->setText("00:00 / 00:00");
+    m_playPauseBtn->setText("⏸");
+    setWindowTitle("Video Player");
+}
+
+void VideoPlayer::pause() {
+    m_mediaPlayer->pause();
+    m_playPauseBtn->setText("▶");
+}
+
+bool VideoPlayer::isPlaying() const {
+    return !m_suspended && m_mediaPlayer->playbackState() == QMediaPlayer::PlayingState;
+}
+
+void VideoPlayer::suspend() {
+    if (m_suspended || m_currentIndex < 0) return;
+    
+    // 다운로드를 기다리던 클립이면 그 위치를 기억
+    if (m_pendingIndex >= 0) {
+        m_suspendedPosition = clipOffset(m_pendingIndex) + m_pendingPosition;
+        m_resumePlaying = m_pendingAutoplay;
+    } else {
+        m_suspendedPosition = clipOffset(m_currentIndex) + m_mediaPlayer->position();
+        m_resumePlaying = m_mediaPlayer->playbackState() == QMediaPlayer::PlayingState;
+    }
+    m_suspended = true;
+    m_pendingIndex = -1;
+    m_seekOnLoad = -1;
+    
+    // 소스 해제로 인한 위치/길이 변경은 화면에 반영하지 않음
+    disconnectActivePlayer();
+    m_mediaPlayer->stop();
+    m_mediaPlayer->setSource(QUrl());
+    connectActivePlayer();
+    m_health->stop();
+    emit playingChanged(this, false);
+    
+    if (m_standbyPlayer) {
+        m_standbyPlayer->stop();
+        m_standbyPlayer->setSource(QUrl());
+    }
+    m_standbyIndex = -1;
+    m_playPauseBtn->setText("▶");
+}
+
+void VideoPlayer::resume() {
+    if (!m_suspended) return;
+    m_suspended = false;
+    
+    qint64 positionInClip = 0;
+    int index = clipIndexAt(m_suspendedPosition, &positionInClip);
+    if (index < 0) return;
+    
+    loadClip(index, positionInClip, m_resumePlaying);
+}
+
+void VideoPlayer::closeEvent(QCloseEvent* event) {
+    QWidget::closeEvent(event);
+    if (event->isAccepted()) {
+        emit closed(this);
+    }
+}
 
 void VideoPlayer::setupUI() {
     m_mainLayout = new QVBoxLayout(this);
     m_mainLayout->setContentsMargins(5, 5, 5, 5);
     m_mainLayout->setSpacing(5);
     
-    // 비디오 위젯 설정
+    // 비디오 위젯 설정 (재생 목록 전환을 위해 스택에 배치)
     m_videoWidget = new QVideoWidget;
     m_videoWidget->setMinimumSize(MIN_VIDEO_WIDTH, MIN_VIDEO_HEIGHT);
     m_videoWidget->setStyleSheet("QVideoWidget { background-color: black; }");
-    m_mainLayout->addWidget(m_videoWidget);
+    m_videoStack = new QStackedLayout;
+    m_videoStack->addWidget(m_videoWidget);
+    m_mainLayout->addLayout(m_videoStack, 1);
     
     // 컨트롤 패널 설정
     m_controlsLayout = new QHBoxLayout;
@@ -68,10 +224,40 @@ void VideoPlayer::setupUI() {
     m_timeLabel->setAlignment(Qt::AlignCenter);
     m_timeLabel->setStyleSheet("QLabel { font-family: monospace; font-size: 12px; color: #333; }");
     
-    // 레이아웃 구성
+    // 모션 에너지 막대 및 다음 스파이크 버튼
+    m_motionStrip = new MotionStrip;
+    m_nextSpikeBtn = new QPushButton("⏭");
+    m_nextSpikeBtn->setFixedSize(CONTROL_BUTTON_WIDTH, CONTROL_BUTTON_HEIGHT);
+    m_nextSpikeBtn->setToolTip("다음 움직임 구간으로 이동");
+    m_nextSpikeBtn->setEnabled(false);
+    
+    // 프레임 내보내기 버튼
+    m_exportBtn = new QPushButton("Export");
+    m_exportBtn->setFixedHeight(CONTROL_BUTTON_HEIGHT);
+    m_exportBtn->setToolTip("프레임 이미지/콘택트 시트 내보내기");
+    
+    // 재생 상태 표시 버튼 및 표시줄 (기본 숨김)
+    m_healthBtn = new QPushButton("Stats");
+    m_healthBtn->setFixedHeight(CONTROL_BUTTON_HEIGHT);
+    m_healthBtn->setCheckable(true);
+    m_healthBtn->setToolTip("재생 상태 표시 (F3)");
+    m_healthLabel = new QLabel;
+    m_healthLabel->setStyleSheet("QLabel { font-family: monospace; font-size: 11px; color: #0f0; background-color: #222; padding: 2px; }");
+    m_healthLabel->setVisible(false);
+    m_mainLayout->addWidget(m_healthLabel);
+    
+    // 레이아웃 구성 (모션 막대는 슬라이더 바로 위)
+    QVBoxLayout* timelineLayout = new QVBoxLayout;
+    timelineLayout->setSpacing(2);
+    timelineLayout->addWidget(m_motionStrip);
+    timelineLayout->addWidget(m_positionSlider);
+    
     m_controlsLayout->addWidget(m_playPauseBtn);
-    m_controlsLayout->addWidget(m_positionSlider, 1); // 슬라이더가 대부분의 공간 차지
+    m_controlsLayout->addLayout(timelineLayout, 1); // 슬라이더가 대부분의 공간 차지
+    m_controlsLayout->addWidget(m_nextSpikeBtn);
     m_controlsLayout->addWidget(m_timeLabel);
+    m_controlsLayout->addWidget(m_exportBtn);
+    m_controlsLayout->addWidget(m_healthBtn);
     
     m_mainLayout->addLayout(m_controlsLayout);
 }
@@ -80,21 +266,270 @@ void VideoPlayer::setupConnections() {
     // UI 컨트롤 연결
     connect(m_playPauseBtn, &QPushButton::clicked, this, &VideoPlayer::onPlayPauseClicked);
     connect(m_positionSlider, &QSlider::sliderMoved, this, &VideoPlayer::onSliderMoved);
+    connect(m_nextSpikeBtn, &QPushButton::clicked, this, &VideoPlayer::onNextSpikeClicked);
+    connect(m_exportBtn, &QPushButton::clicked, this, &VideoPlayer::onExportClicked);
+    connect(m_healthBtn, &QPushButton::clicked, this, &VideoPlayer::onHealthToggled);
+    QShortcut* healthShortcut = new QShortcut(QKeySequence(Qt::Key_F3), this);
+    connect(healthShortcut, &QShortcut::activated, this, &VideoPlayer::onHealthToggled);
+    
+    // 재생 상태 측정 (창마다 번호를 붙여 세션 로그에서 구분)
+    static int playerCount = 0;
+    m_health = new PlaybackHealthMonitor(QString("player-%1").arg(++playerCount), this);
+    connect(m_health, &PlaybackHealthMonitor::sampled, this, [this](const QString& summary) {
+        if (m_healthLabel->isVisible()) {
+            m_healthLabel->setText(summary);
+        }
+    });
     
     // 미디어 플레이어 연결
+    connectActivePlayer();
+}
+
+void VideoPlayer::connectActivePlayer() {
     connect(m_mediaPlayer, &QMediaPlayer::positionChanged, this, &VideoPlayer::onPositionChanged);
     connect(m_mediaPlayer, &QMediaPlayer::durationChanged, this, &VideoPlayer::onDurationChanged);
     connect(m_mediaPlayer, &QMediaPlayer::mediaStatusChanged, this, &VideoPlayer::onMediaStatusChanged);
     connect(m_mediaPlayer, &QMediaPlayer::errorOccurred, this, &VideoPlayer::onErrorOccurred);
+    connect(m_mediaPlayer, &QMediaPlayer::playbackStateChanged, this, [this](QMediaPlayer::PlaybackState state) {
+        emit playingChanged(this, state == QMediaPlayer::PlayingState);
+    });
+    
+    // 첫 프레임 측정
+    connect(m_videoWidget->videoSink(), &QVideoSink::videoFrameChanged, this, &VideoPlayer::onFirstFrame);
+    m_health->attach(m_mediaPlayer, m_videoWidget->videoSink());
 }
 
-void VideoPlayer::loadAndPlayVideo() {
-    QUrl videoUrl = QUrl::fromLocalFile(m_videoPath);
-    m_mediaPlayer->setSource(videoUrl);
-    m_mediaPlayer->setVideoOutput(m_videoWidget);
+void VideoPlayer::disconnectActivePlayer() {
+    disconnect(m_mediaPlayer, nullptr, this, nullptr);
+    disconnect(m_videoWidget->videoSink(), nullptr, this, nullptr);
+}
+
+void VideoPlayer::ensureStandby() {
+    if (m_standbyPlayer) return;
+    
+    m_standbyWidget = new QVideoWidget;
+    m_standbyWidget->setMinimumSize(MIN_VIDEO_WIDTH, MIN_VIDEO_HEIGHT);
+    m_standbyWidget->setStyleSheet("QVideoWidget { background-color: black; }");
+    m_videoStack->addWidget(m_standbyWidget);
+    
+    m_standbyPlayer = new QMediaPlayer(this);
+    m_standbyPlayer->setVideoOutput(m_standbyWidget);
+}
+
+void VideoPlayer::loadClip(int index, qint64 positionMs, bool autoplay) {
+    if (index < 0 || index >= m_playlist.size()) return;
+    
+    // 아직 받지 않은 클립은 다운로드 완료 후 다시 로드
+    if (m_playlist[index].localPath.isEmpty()) {
+        m_pendingIndex = index;
+        m_pendingPosition = positionMs;
+        m_pendingAutoplay = autoplay;
+        m_mediaPlayer->pause();
+        m_timeLabel->setText("Loading...");
+        fetchClip(index);
+        return;
+    }
+    m_pendingIndex = -1;
+    
+    // 대기 플레이어에 이미 준비된 클립이면 출력만 전환
+    if (index == m_standbyIndex) {
+        switchToStandby(autoplay);
+        if (positionMs > 0) {
+            m_mediaPlayer->setPosition(positionMs);
+        }
+        return;
+    }
+    
+    m_currentIndex = index;
+    m_videoPath = m_playlist[index].localPath;
+    updateWindowTitle();
+    
+    m_seekOnLoad = positionMs > 0 ? positionMs : -1;
+    m_mediaPlayer->setSource(QUrl::fromLocalFile(m_videoPath));
+    
+    if (autoplay) {
+        m_mediaPlayer->play();
+        m_playPauseBtn->setText("⏸");
+    } else {
+        m_mediaPlayer->pause();
+        m_playPauseBtn->setText("▶");
+    }
+    
+    prefetchNext();
+}
+
+void VideoPlayer::fetchClip(int index) {
+    if (!m_fetcher || m_fetching.contains(index) || !m_playlist[index].localPath.isEmpty()) {
+        return;
+    }
+    m_fetching.insert(index);
     
-    // 자동 재생 시작
-    m_mediaPlayer->play();
+    QPointer<VideoPlayer> self(this);
+    int generation = m_playlistGeneration;
+    bool urgent = (m_pendingIndex == index);
+    m_fetcher(m_playlist[index].httpUrl, urgent, [self, generation, index](bool success, const QString& localPath) {
+        // 창이 닫혀 재사용되었으면 무시
+        if (!self || self->m_playlistGeneration != generation) return;
+        self->m_fetching.remove(index);
+        
+        if (!success) {
+            qWarning() << "Playlist clip download failed:" << self->m_playlist[index].httpUrl;
+            if (self->m_pendingIndex == index) {
+                self->m_pendingIndex = -1;
+                self->m_timeLabel->setText("Download failed");
+            }
+            return;
+        }
+        
+        self->m_playlist[index].localPath = localPath;
+        self->requestMotionAnalysis(localPath);
+        if (self->m_suspended) return;
+        if (self->m_pendingIndex == index) {
+            self->loadClip(index, self->m_pendingPosition, self->m_pendingAutoplay);
+        } else if (index == self->m_currentIndex + 1) {
+            self->preloadStandby(index);
+        }
+    });
+}
+
+void VideoPlayer::prefetchNext() {
+    int next = m_currentIndex + 1;
+    if (next <= 0 || next >= m_playlist.size()) return;
+    
+    if (m_playlist[next].localPath.isEmpty()) {
+        fetchClip(next);
+    } else if (m_standbyIndex != next) {
+        preloadStandby(next);
+    }
+}
+
+void VideoPlayer::preloadStandby(int index) {
+    ensureStandby();
+    
+    // 일시정지 상태로 로드해 디코더와 첫 프레임을 미리 준비
+    m_standbyIndex = index;
+    m_standbyPlayer->setSource(QUrl::fromLocalFile(m_playlist[index].localPath));
+    m_standbyPlayer->pause();
+}
+
+void VideoPlayer::switchToStandby(bool autoplay) {
+    QMediaPlayer* previousPlayer = m_mediaPlayer;
+    
+    disconnectActivePlayer();
+    std::swap(m_mediaPlayer, m_standbyPlayer);
+    std::swap(m_videoWidget, m_standbyWidget);
+    m_currentIndex = m_standbyIndex;
+    m_standbyIndex = -1;
+    connectActivePlayer();
+    
+    // 새 클립을 먼저 시작한 뒤 출력 위젯 전환
+    if (autoplay) {
+        m_mediaPlayer->play();
+        m_playPauseBtn->setText("⏸");
+    } else {
+        m_playPauseBtn->setText("▶");
+    }
+    m_videoStack->setCurrentWidget(m_videoWidget);
+    previousPlayer->stop();
+    
+    m_videoPath = m_playlist[m_currentIndex].localPath;
+    updateWindowTitle();
+    
+    if (m_mediaPlayer->duration() > 0) {
+        m_playlist[m_currentIndex].durationMs = m_mediaPlayer->duration();
+        updateTimelineRange();
+    }
+    
+    prefetchNext();
+}
+
+qint64 VideoPlayer::clipOffset(int index) const {
+    qint64 offset = 0;
+    for (int i = 0; i < index && i < m_playlist.size(); ++i) {
+        offset += m_playlist[i].durationMs;
+    }
+    return offset;
+}
+
+qint64 VideoPlayer::totalDuration() const {
+    return clipOffset(m_playlist.size());
+}
+
+int VideoPlayer::clipIndexAt(qint64 timelineMs, qint64* positionInClip) const {
+    qint64 offset = 0;
+    for (int i = 0; i < m_playlist.size(); ++i) {
+        qint64 duration = m_playlist[i].durationMs;
+        if (timelineMs < offset + duration || i == m_playlist.size() - 1) {
+            if (positionInClip) *positionInClip = qMax<qint64>(0, timelineMs - offset);
+            return i;
+        }
+        offset += duration;
+    }
+    return -1;
+}
+
+void VideoPlayer::updateTimelineRange() {
+    m_positionSlider->setMaximum(static_cast<int>(totalDuration()));
+    updateMotionStrip();
+}
+
+void VideoPlayer::requestMotionAnalysis(const QString& videoPath) {
+    if (videoPath.isEmpty() || m_motionEnergy.contains(videoPath)) return;
+    
+    QVector<float> energy;
+    if (MotionAnalysisJob::loadCached(videoPath, energy)) {
+        m_motionEnergy.insert(videoPath, energy);
+        return;
+    }
+    
+    // 분석 중에는 빈 신호로 두고 중간 결과로 채움
+    m_motionEnergy.insert(videoPath, QVector<float>());
+    if (MotionAnalysisJob* job = MotionAnalysisJob::enqueue(videoPath)) {
+        connect(job, &MotionAnalysisJob::progress, this, &VideoPlayer::onMotionEnergyUpdated, Qt::UniqueConnection);
+        connect(job, &MotionAnalysisJob::finished, this, &VideoPlayer::onMotionEnergyUpdated, Qt::UniqueConnection);
+    }
+}
+
+void VideoPlayer::onMotionEnergyUpdated(const QString& videoPath, const QVector<float>& energy) {
+    // 재사용 후 다른 재생 목록의 결과는 무시
+    if (!m_motionEnergy.contains(videoPath) || energy.isEmpty()) return;
+    m_motionEnergy[videoPath] = energy;
+    updateMotionStrip();
+}
+
+void VideoPlayer::updateMotionStrip() {
+    QList<MotionSegment> segments;
+    qint64 offset = 0;
+    for (const PlaylistEntry& entry : m_playlist) {
+        MotionSegment segment;
+        segment.offsetMs = offset;
+        segment.durationMs = entry.durationMs;
+        segment.energy = m_motionEnergy.value(entry.localPath);
+        segments.append(segment);
+        offset += entry.durationMs;
+    }
+    
+    m_motionStrip->setSegments(segments, offset);
+    m_nextSpikeBtn->setEnabled(m_motionStrip->hasEnergy());
+}
+
+void VideoPlayer::updateWindowTitle() {
+    QString fileName = QFileInfo(m_videoPath).fileName();
+    if (m_playlist.size() > 1) {
+        setWindowTitle(QString("Video Player - %1 (%2/%3)")
+                       .arg(fileName)
+                       .arg(m_currentIndex + 1)
+                       .arg(m_playlist.size()));
+    } else {
+        setWindowTitle(QString("Video Player - %1").arg(fileName));
+    }
+}
+
+void VideoPlayer::onFirstFrame() {
+    if (!m_waitingFirstFrame) return;
+    m_waitingFirstFrame = false;
+    qDebug() << "First frame of" << QFileInfo(m_videoPath).fileName()
+             << "in" << m_openTimer.elapsed() << "ms";
 }
 
 QString VideoPlayer::formatTime(qint64 timeMs) const {
@@ -120,16 +555,18 @@ void VideoPlayer::onPlayPauseClicked() {
 }
 
 void VideoPlayer::onPositionChanged(qint64 position) {
+    // 재생 목록에서는 통합 타임라인 기준 위치
+    qint64 timelinePosition = clipOffset(m_currentIndex) + position;
+    
     // 사용자가 슬라이더를 드래그하고 있을 때는 업데이트하지 않음
     if (!m_positionSlider->isSliderDown()) {
-        m_positionSlider->setValue(static_cast<int>(position));
+        m_positionSlider->setValue(static_cast<int>(timelinePosition));
     }
     
     // 시간 표시 업데이트
-    qint64 duration = m_mediaPlayer->duration();
     QString timeText = QString("%1 / %2")
-        .arg(formatTime(position))
-        .arg(formatTime(duration));
+        .arg(formatTime(timelinePosition))
+        .arg(formatTime(totalDuration()));
     
     m_timeLabel->setText(timeText);
 }
@@ -137,12 +574,22 @@ void VideoPlayer::onPositionChanged(qint64 position) {
 void VideoPlayer::onMediaStatusChanged(QMediaPlayer::MediaStatus status) {
     switch (status) {
     case QMediaPlayer::LoadedMedia:
-        // 미디어 로드 완료
+        // 미디어 로드 완료 - 예약된 위치로 이동
+        if (m_seekOnLoad >= 0) {
+            m_health->markSeek();
+            m_mediaPlayer->setPosition(m_seekOnLoad);
+            m_seekOnLoad = -1;
+        }
         break;
     case QMediaPlayer::InvalidMedia:
         QMessageBox::warning(this, "Media Error", "지원되지 않는 비디오 형식입니다.");
         break;
     case QMediaPlayer::EndOfMedia:
+        // 다음 클립이 있으면 이어서 재생
+        if (m_currentIndex + 1 < m_playlist.size()) {
+            loadClip(m_currentIndex + 1, 0, true);
+            break;
+        }
         // 재생 완료 시 재생 버튼 상태 리셋
         m_playPauseBtn->setText("▶");
         break;
@@ -175,9 +622,154 @@ void VideoPlayer::onErrorOccurred(QMediaPlayer::Error error, const QString& erro
 }
 
 void VideoPlayer::onDurationChanged(qint64 duration) {
-    m_positionSlider->setMaximum(duration);
+    // 실제 길이로 재생 목록 항목 갱신
+    if (m_currentIndex >= 0 && m_currentIndex < m_playlist.size() && duration > 0) {
+        m_playlist[m_currentIndex].durationMs = duration;
+    }
+    updateTimelineRange();
 }
 
 void VideoPlayer::onSliderMoved(int position) {
-    m_mediaPlayer->setPosition(position);
-}
\ No newline at end of file
+    seekTimeline(position);
+}
+
+void VideoPlayer::onNextSpikeClicked() {
+    qint64 current = clipOffset(m_currentIndex) + m_mediaPlayer->position();
+    qint64 spike = m_motionStrip->nextSpike(current);
+    if (spike < 0) return;
+    
+    m_positionSlider->setValue(static_cast<int>(spike));
+    seekTimeline(spike);
+}
+
+void VideoPlayer::onExportClicked() {
+    if (m_currentIndex < 0 || m_videoPath.isEmpty()) return;
+    if (m_frameExporter) {
+        QMessageBox::information(this, "Export", "이미 내보내기가 진행 중입니다.");
+        return;
+    }
+    
+    const PlaylistEntry& clip = m_playlist[m_currentIndex];
+    QString baseName = QFileInfo(m_videoPath).completeBaseName();
+    QString defaultDir = QDir(QStandardPaths::writableLocation(QStandardPaths::PicturesLocation))
+                             .filePath(baseName + "_frames");
+    
+    // 내보내기 설정 입력
+    QDialog dialog(this);
+    dialog.setWindowTitle("Export Frames");
+    QFormLayout* form = new QFormLayout(&dialog);
+    
+    QComboBox* modeCombo = new QComboBox;
+    modeCombo->addItem("Every N seconds", FrameExportOptions::Interval);
+    modeCombo->addItem("Burst around current position", FrameExportOptions::Burst);
+    QSpinBox* intervalSpin = new QSpinBox;
+    intervalSpin->setRange(1, 3600);
+    intervalSpin->setValue(DEFAULT_EXPORT_INTERVAL_SECONDS);
+    intervalSpin->setSuffix(" s");
+    QSpinBox* burstCountSpin = new QSpinBox;
+    burstCountSpin->setRange(1, 100);
+    burstCountSpin->setValue(DEFAULT_BURST_COUNT);
+    QSpinBox* burstSpacingSpin = new QSpinBox;
+    burstSpacingSpin->setRange(10, 10000);
+    burstSpacingSpin->setValue(DEFAULT_BURST_SPACING_MS);
+    burstSpacingSpin->setSuffix(" ms");
+    QComboBox* formatCombo = new QComboBox;
+    formatCombo->addItem("PNG", "png");
+    formatCombo->addItem("JPEG", "jpg");
+    QCheckBox* sheetCheck = new QCheckBox("Contact sheet");
+    sheetCheck->setChecked(true);
+    QPushButton* dirButton = new QPushButton(defaultDir);
+    connect(dirButton, &QPushButton::clicked, &dialog, [&dialog, dirButton]() {
+        QString dir = QFileDialog::getExistingDirectory(&dialog, "Export Folder", dirButton->text());
+        if (!dir.isEmpty()) dirButton->setText(dir);
+    });
+    
+    form->addRow("Mode:", modeCombo);
+    form->addRow("Interval:", intervalSpin);
+    form->addRow("Burst frames:", burstCountSpin);
+    form->addRow("Burst spacing:", burstSpacingSpin);
+    form->addRow("Format:", formatCombo);
+    form->addRow("", sheetCheck);
+    form->addRow("Folder:", dirButton);
+    
+    QDialogButtonBox* buttons = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel);
+    connect(buttons, &QDialogButtonBox::accepted, &dialog, &QDialog::accept);
+    connect(buttons, &QDialogButtonBox::rejected, &dialog, &QDialog::reject);
+    form->addRow(buttons);
+    
+    if (dialog.exec() != QDialog::Accepted) return;
+    
+    FrameExportOptions options;
+    options.mode = static_cast<FrameExportOptions::Mode>(modeCombo->currentData().toInt());
+    options.intervalSeconds = intervalSpin->value();
+    options.burstCenterMs = m_mediaPlayer->position();
+    options.burstCount = burstCountSpin->value();
+    options.burstSpacingMs = burstSpacingSpin->value();
+    options.format = formatCombo->currentData().toString();
+    options.contactSheet = sheetCheck->isChecked();
+    options.outputDir = dirButton->text();
+    options.createdTime = clip.createdTime;
+    
+    // 재생과 별개의 디코더로 내보내기 (재생은 계속됨)
+    m_frameExporter = new FrameExporter(this);
+    QPointer<QProgressDialog> progressDialog = new QProgressDialog("Exporting frames...", "Cancel", 0, 0, this);
+    progressDialog->setWindowModality(Qt::NonModal);
+    progressDialog->setMinimumDuration(0);
+    
+    FrameExporter* exporter = m_frameExporter;
+    connect(progressDialog, &QProgressDialog::canceled, exporter, &FrameExporter::cancel);
+    connect(exporter, &FrameExporter::progress, progressDialog, [progressDialog](int done, int total) {
+        progressDialog->setMaximum(total);
+        progressDialog->setValue(done);
+    });
+    connect(exporter, &FrameExporter::finished, this,
+            [this, exporter, progressDialog, options](bool success, int savedFrames, const QString& sheetPath) {
+        bool canceled = !progressDialog || progressDialog->wasCanceled();
+        if (progressDialog) progressDialog->deleteLater();
+        m_frameExporter = nullptr;
+        exporter->deleteLater();
+        
+        // 창이 닫혀 풀로 돌아갔거나 사용자가 취소했으면 알리지 않음
+        if (canceled || !isVisible()) return;
+        if (success) {
+            QString message = QString("%1개 프레임을 저장했습니다.\n폴더: %2").arg(savedFrames).arg(options.outputDir);
+            if (!sheetPath.isEmpty()) {
+                message += QString("\n콘택트 시트: %1").arg(QFileInfo(sheetPath).fileName());
+            }
+            QMessageBox::information(this, "Export", message);
+        } else {
+            QMessageBox::warning(this, "Export", "프레임을 내보내지 못했습니다.");
+        }
+    });
+    
+    if (!exporter->start(m_videoPath, options)) {
+        progressDialog->deleteLater();
+        m_frameExporter = nullptr;
+        exporter->deleteLater();
+        QMessageBox::warning(this, "Export", QString("폴더를 만들 수 없습니다: %1").arg(options.outputDir));
+        return;
+    }
+    progressDialog->show();
+}
+
+void VideoPlayer::onHealthToggled() {
+    bool visible = !m_healthLabel->isVisible();
+    m_healthLabel->setVisible(visible);
+    m_healthLabel->setText(m_health->summary().isEmpty() ? "Measuring..." : m_health->summary());
+    m_healthBtn->setChecked(visible);
+}
+
+void VideoPlayer::seekTimeline(qint64 timelineMs) {
+    qint64 positionInClip = 0;
+    int index = clipIndexAt(timelineMs, &positionInClip);
+    if (index < 0) return;
+    m_health->markSeek();
+    
+    if (index == m_currentIndex) {
+        m_mediaPlayer->setPosition(positionInClip);
+    } else {
+        // 다른 클립 구간으로 이동
+        bool playing = m_mediaPlayer->playbackState() == QMediaPlayer::PlayingState;
+        loadClip(index, positionInClip, playing);
+    }
+}
@@ -0,0 +1,79 @@
+#include "../../include/video/videoplayer_pool.h"
+#include <QElapsedTimer>
+#include <QLayout>
+#include <QSettings>
+#include <QTimer>
+#include <QDebug>
+
+VideoPlayerPool::VideoPlayerPool(int poolSize, QObject *parent)
+    : QObject(parent)
+    , m_poolSize(qBound(0, poolSize, MAX_POOL_SIZE))
+{
+}
+
+VideoPlayerPool::~VideoPlayerPool() {
+    // 최상위 창이라 부모가 없으므로 직접 삭제
+    qDeleteAll(m_activePlayers);
+    qDeleteAll(m_idlePlayers);
+}
+
+int VideoPlayerPool::configuredPoolSize() {
+    QSettings settings;
+    return settings.value("player/poolSize", DEFAULT_POOL_SIZE).toInt();
+}
+
+void VideoPlayerPool::warmUp(int delayMs) {
+    QTimer::singleShot(delayMs, this, &VideoPlayerPool::warmUpNext);
+}
+
+void VideoPlayerPool::warmUpNext() {
+    if (m_idlePlayers.size() >= m_poolSize) return;
+    
+    QElapsedTimer timer;
+    timer.start();
+    m_idlePlayers.append(createPlayer());
+    qDebug() << "Pre-warmed video player" << m_idlePlayers.size() << "/" << m_poolSize
+             << "in" << timer.elapsed() << "ms";
+    
+    // UI가 멈추지 않도록 다음 인스턴스는 다음 이벤트 루프에서 생성
+    QTimer::singleShot(0, this, &VideoPlayerPool::warmUpNext);
+}
+
+VideoPlayer* VideoPlayerPool::createPlayer() {
+    VideoPlayer* player = new VideoPlayer;
+    
+    // 스타일/레이아웃 계산을 미리 끝내 둠
+    player->ensurePolished();
+    if (player->layout()) {
+        player->layout()->activate();
+    }
+    
+    connect(player, &VideoPlayer::closed, this, &VideoPlayerPool::release);
+    return player;
+}
+
+VideoPlayer* VideoPlayerPool::acquire() {
+    VideoPlayer* player = m_idlePlayers.isEmpty() ? createPlayer() : m_idlePlayers.takeLast();
+    m_activePlayers.append(player);
+    
+    // 풀에서 꺼낸 만큼 다시 채워 둠
+    if (m_idlePlayers.size() < m_poolSize) {
+        warmUp(0);
+    }
+    return player;
+}
+
+void VideoPlayerPool::release(VideoPlayer* player) {
+    if (!m_activePlayers.removeOne(player)) return;
+    
+    player->hide();
+    player->reset();
+    
+    if (m_idlePlayers.size() < m_poolSize) {
+        m_idlePlayers.append(player);
+    } else {
+        player->deleteLater();
+    }
+    
+    emit playerReleased(player);
+}